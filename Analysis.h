@@ -491,7 +491,7 @@ inline void Analysis<T,FLT>::op2( uint16_t _op, const T * opnd1, const T& opnd2
 {
     std::lock_guard<std::mutex> guard(lock);
     OP op = OP(_op);
-    cassert( op == OP::scalbn || op == OP::pop_value, "op2i allowed only for scalbn/pop_value" );
+    cassert( op == OP::scalbn || op == OP::pown || op == OP::rootn || op == OP::pop_value, "op2i allowed only for scalbn/pown/rootn/pop_value" );
     inc_op_cnt_nolock( op );
     auto it = vals.find( reinterpret_cast<uint64_t>( opnd1 ) );
     cassert( it != vals.end() && it->second.is_alive, "opnd[0] does not exist" );
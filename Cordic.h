@@ -26,8 +26,16 @@
 #include <iostream>
 #include <iomanip>
 #include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 #include "Logger.h"
+#include "ThreadPool.h"
 
 #ifdef DEBUG_LEVEL
 static constexpr uint32_t debug = DEBUG_LEVEL;
@@ -49,11 +57,52 @@ static constexpr bool do_asserts = true;
 static constexpr int FE_NOROUND      = 0x1000;  // perform no rounding at all; leave guard bits alone
 static constexpr int FE_AWAYFROMZERO = 0x2000;  // signbit(x) ? trunc(x) : ceil(x);   and clear guard bits
 
+// every function that has an array version, by operand shape: 
+// (in -> out), (in, in -> out), (in, in, in -> out), (in -> out, out), (in, in -> out, out)
+// (see Array Versions in the class for which of them are blocked and which loop over the scalar version)
+//
+#define _CORDIC_ARRAY_FUNCS( _1, _2, _3, _1_2, _2_2 ) \
+    _1( sqrt ) _1( rsqrt ) _1( cbrt ) _1( rcbrt ) \
+    _1( exp ) _1( expm1 ) _1( exp2 ) _1( exp10 ) _2( pow ) \
+    _1( log ) _1( log1p ) _1( log2 ) _1( log10 ) \
+    _1( deg2rad ) _1( rad2deg ) \
+    _1( sin ) _1( sinpi ) _1( cos ) _1( cospi ) _1_2( sincos ) _1_2( sinpicospi ) \
+    _1( tan ) _1( tanpi ) _1( asin ) _1( acos ) _1( atan ) _2( atan2 ) \
+    _2_2( polar_to_rect ) _2_2( rect_to_polar ) _2( hypot ) _2( hypoth ) \
+    _1( sinh ) _1( cosh ) _1_2( sinhcosh ) _1( tanh ) _1( asinh ) _1( acosh ) _1( atanh ) _2( atanh2 ) \
+    _1( abs ) _1( neg ) _1( floor ) _1( ceil ) _1( trunc ) _1( round ) \
+    _2( add ) _2( sub ) _3( fma ) _2( mul ) _1( sqr ) _3( fda ) _2( div ) \
+    _2( remainder ) _2( fmod ) _1( rcp ) _2( fdim ) _2( fmax ) _2( fmin )
+
+//-----------------------------------------------------
+// CORE supplies the basic CORDIC iterations when the number format is fixed at compile time
+// (see StaticCordic.h).  The default has none, so Cordic runs its own loops.
+//-----------------------------------------------------
+template< typename T >
+struct CordicCore
+{
+    static constexpr bool is_static = false;
+};
+
+//-----------------------------------------------------
+// The logger is kept apart from Cordic so that every CORE with the same T and FLT shares it.
+//-----------------------------------------------------
+template< typename T, typename FLT >
+class CordicLogging
+{
+protected:
+    static thread_local Logger<T,FLT> * logger;
+};
+
+template< typename T, typename FLT >
+thread_local Logger<T,FLT> * CordicLogging<T,FLT>::logger = nullptr;
+
 // T      = some signed integer type that can hold fixed-point values (default is int64_t)
 // FLT    = some floating-point type that can hold constants of the desired precision (default is double)
+// CORE   = the basic CORDIC iterations (default is CordicCore, i.e., Cordic's own loops)
 //
-template< typename T=int64_t, typename FLT=double >              
-class Cordic
+template< typename T=int64_t, typename FLT=double, typename CORE=CordicCore<T> >
+class Cordic : public CordicLogging<T,FLT>
 {
 public:
     //-----------------------------------------------------
@@ -67,11 +116,22 @@ public:
     //
     // So the most significant bit is the sign, followed by int_exp_w bits of integer/exponent, followed by frac_w+guard_w bits of fraction.
     //-----------------------------------------------------
+    enum class BACKEND
+    {
+        CORDIC,                         // mul/fma via linear_rotation(), div/fda via linear_vectoring()
+        NATIVE,                         // mul/fma via widening integer multiply, div/fda via Newton-Raphson reciprocal
+    };
+
     Cordic( uint32_t int_exp_w,                 // fixed-point integer width  OR floating-point exponent width
             uint32_t frac_w,                    // fixed-point fraction width OR floating-point mantissa width
             bool     is_float=true,             // true=floating-point, false=fixed-point
             uint32_t guard_w=-1,                // number of guard bits used for CORDIC proper (-1 == default == log2(frac_w))
-            uint32_t n=-1 );                    // number of iterations used for CORDIC proper (-1 == default == frac_w)
+            uint32_t n=-1,                      // number of iterations used for CORDIC proper (-1 == default == frac_w)
+            uint32_t radix=2,                   // 2 or 4; 4 resolves two bits per circular/hyperbolic rotation step (see below)
+            uint32_t shortcut_i=0,              // circular/hyperbolic iterations before finishing with one mul/div (0 == off, -1 == default, see below)
+            uint32_t sincos_lut_w=0,            // log2 of number of (cos,sin) table entries that sincos() starts from (0 == off, see below)
+            uint32_t exp_log_lut_w=0,           // log2 of number of exp and log table entries that exp() and log() start from (0 == off, see below)
+            BACKEND  arith_backend=BACKEND::CORDIC ); // how mul/fma/div/fda compute the product/quotient of the reduced mantissas
     ~Cordic();
     
     void log_constructed( void );               // for when Cordic constructed before logging enabled
@@ -101,6 +161,11 @@ public:
     uint32_t guard_w( void ) const;                     // guard_w from above
     uint32_t w( void ) const;                           // 1 + int_exp_w + frac_w + guard_w (i.e., overall width)
     uint32_t n( void ) const;                           // n       from above
+    uint32_t radix( void ) const;                       // radix   from above
+    uint32_t shortcut_i( void ) const;                  // shortcut_i from above (0 == off)
+    uint32_t sincos_lut_w( void ) const;                // sincos_lut_w from above (0 == off)
+    uint32_t exp_log_lut_w( void ) const;               // exp_log_lut_w from above (0 == off)
+    BACKEND  arith_backend( void ) const;               // arith_backend from above
     T maxint( void ) const;                             // largest positive integer (just integer part)
 
     T max( void ) const;                                // encoded maximum positive value 
@@ -155,6 +220,8 @@ public:
     // rounding
     int  fesetround( int round );                                       // set rounding mode to FE_{DOWNWARD,UPWARD,TOWARDZDERO,TONEAREST}; return 0
     int  fegetround( void ) const;                                      // returns current rounding mode
+    void correctly_rounded_set( bool enable );                          // correctly-rounded math functions on/off (see its definition)
+    bool correctly_rounded_get( void ) const;                           // returns whether correctly-rounded mode is on
     T    nextafter( const T& from, const T& to ) const;                 // (from == to) ?      to  : (from +/- min toward to)
     T    nexttoward( const T& from, long double to ) const;             // (from == to) ? to_t(to) : (from +/- min toward to)
     T    floor( const T& x ) const;                                     // largest  integral value <= x
@@ -200,7 +267,7 @@ public:
     T    ldexp( const T& x, int y ) const;                              // x * 2^y    (same as scalbn)
     T    fma( const T& x, const T& y, const T& addend ) const;          // x*y + addend
     T    mul( const T& x, const T& y ) const;                           // x*y 
-    T    mulc( const T& x, const T& c ) const;                          // x*c where c is known to be a constant
+    T    mulc( const T& x, const T& c ) const;                          // x*c where c is usually a constant (same as mul())
     T    sqr( const T& x ) const;                                       // x*x
     T    fda( const T& y, const T& x, const T& addend ) const;          // y/x + addend
     T    div( const T& y, const T& x ) const;                           // y/x
@@ -227,8 +294,8 @@ public:
     T    sqrt( const T& x ) const;                                      // hypoth( x+1, x-1 ) / 2
     T    rsqrt( const T& x ) const;                                     // 1.0 / sqrt( x )
     T    rsqrt_orig( const T& x ) const;                                // x^(-1/2) = exp(log(x)/-2)
-    T    cbrt( const T& x ) const;                                      // x^(1/3)  = exp(log(x)/3)
-    T    rcbrt( const T& x ) const;                                     // x^(-1/3) = exp(log(x)/-3)
+    T    cbrt( const T& x ) const;                                      // x^(1/3)
+    T    rcbrt( const T& x ) const;                                     // x^(-1/3)
 
     T    exp( const T& x ) const;                                       // e^x
     T    expm1( const T& x ) const;                                     // e^x - 1
@@ -236,6 +303,8 @@ public:
     T    exp2( const T& x ) const;                                      // 2^x
     T    exp10( const T& x ) const;                                     // 10^x
     T    pow( const T& b, const T& x ) const;                           // b^x  = exp(x * log(b))              (3)
+    T    pown( const T& x, int n ) const;                               // x^n  by repeated squaring
+    T    rootn( const T& x, int n ) const;                              // x^(1/n)
     T    log( const T& x ) const;                                       // 2*atanh2(x-1, x+1)    
     T    log( const T& x, const T& b ) const;                           // log(x)/log(b)                (3)
     T    log1p( const T& x ) const;                                     // 2*atanh2(x, x+2) = log(x+1)
@@ -253,8 +322,8 @@ public:
     void sinpicospi( const T& x, T& si, T& co, const T * r=nullptr ) const;// si=r*sin(x*PI), co=r*cos(x*PI) (default r is 1)
     T    tan( const T& x ) const;                                       // sin(x) / cos(x)              (2)
     T    tanpi( const T& x ) const;                                     // sin(x*PI) / cos(x*PI)        (2)
-    T    asin( const T& x ) const;                                      // atan2(x, sqrt(1 - x^2))      (2)
-    T    acos( const T& x ) const;                                      // atan2(sqrt(1 - x^2), x)      (2)
+    T    asin( const T& x ) const;                                      // asin(x)
+    T    acos( const T& x ) const;                                      // acos(x)
     T    atan( const T& x ) const;                                      // atan(x)
     T    atan2( const T& y, const T& x ) const;                         // atan2(y, x)                  
 
@@ -272,6 +341,164 @@ public:
     T    atanh( const T& x ) const;                                     // atanh(x)
     T    atanh2( const T& y, const T& x ) const;                        // atanh(y/x)
 
+    //-----------------------------------------------------
+    // Array Versions
+    //
+    // out[k] = fn(in[k]) for k = 0 .. n-1; multi-operand functions take one array per operand.
+    // Outputs may be the same arrays as inputs.  Results are identical to the scalar versions above.
+    //
+    // Only sin, cos, sinpi, cospi, sincos, sinpicospi, exp, exp2, exp10, and hypot are blocked:
+    // they work on ARRAY_BLOCK elements at a time with one argument-reduction pass, one batch
+    // CORDIC call (see below), and one reconstruction pass.  The logger, correctly-rounded mode,
+    // and rounding mode are checked once per call; if a logger is installed or correctly-rounded
+    // mode is on, each element goes through the scalar version so that it gets logged or retried.
+    //
+    // The rest are plain loops over the scalar versions, so they cost the same per element as
+    // calling the scalar version yourself, including its logger check:
+    //
+    //     sqrt rsqrt cbrt rcbrt expm1 pow log log1p log2 log10 deg2rad rad2deg
+    //     tan tanpi asin acos atan atan2 polar_to_rect rect_to_polar hypoth
+    //     sinh cosh sinhcosh tanh asinh acosh atanh atanh2
+    //     abs neg floor ceil trunc round add sub fma mul sqr fda div remainder fmod rcp fdim fmax fmin
+    //
+    // They exist so that every function can be handed to parallel() below; they are not a bulk
+    // speed-up on their own.
+    //-----------------------------------------------------
+    void sqrt( const T * x, T * r, size_t n ) const;
+    void rsqrt( const T * x, T * r, size_t n ) const;
+    void cbrt( const T * x, T * r, size_t n ) const;
+    void rcbrt( const T * x, T * r, size_t n ) const;
+    void exp( const T * x, T * r, size_t n ) const;
+    void expm1( const T * x, T * r, size_t n ) const;
+    void exp2( const T * x, T * r, size_t n ) const;
+    void exp10( const T * x, T * r, size_t n ) const;
+    void pow( const T * b, const T * x, T * r, size_t n ) const;
+    void log( const T * x, T * r, size_t n ) const;
+    void log1p( const T * x, T * r, size_t n ) const;
+    void log2( const T * x, T * r, size_t n ) const;
+    void log10( const T * x, T * r, size_t n ) const;
+    void deg2rad( const T * x, T * r, size_t n ) const;
+    void rad2deg( const T * x, T * r, size_t n ) const;
+    void sin( const T * x, T * r, size_t n ) const;
+    void sinpi( const T * x, T * r, size_t n ) const;
+    void cos( const T * x, T * r, size_t n ) const;
+    void cospi( const T * x, T * r, size_t n ) const;
+    void sincos( const T * x, T * si, T * co, size_t n ) const;
+    void sinpicospi( const T * x, T * si, T * co, size_t n ) const;
+    void tan( const T * x, T * r, size_t n ) const;
+    void tanpi( const T * x, T * r, size_t n ) const;
+    void asin( const T * x, T * r, size_t n ) const;
+    void acos( const T * x, T * r, size_t n ) const;
+    void atan( const T * x, T * r, size_t n ) const;
+    void atan2( const T * y, const T * x, T * r, size_t n ) const;
+    void polar_to_rect( const T * r, const T * a, T * x, T * y, size_t n ) const;
+    void rect_to_polar( const T * x, const T * y, T * r, T * a, size_t n ) const;
+    void hypot( const T * x, const T * y, T * r, size_t n ) const;
+    void hypoth( const T * x, const T * y, T * r, size_t n ) const;
+    void sinh( const T * x, T * r, size_t n ) const;
+    void cosh( const T * x, T * r, size_t n ) const;
+    void sinhcosh( const T * x, T * sih, T * coh, size_t n ) const;
+    void tanh( const T * x, T * r, size_t n ) const;
+    void asinh( const T * x, T * r, size_t n ) const;
+    void acosh( const T * x, T * r, size_t n ) const;
+    void atanh( const T * x, T * r, size_t n ) const;
+    void atanh2( const T * y, const T * x, T * r, size_t n ) const;
+
+    void abs( const T * x, T * r, size_t n ) const;
+    void neg( const T * x, T * r, size_t n ) const;
+    void floor( const T * x, T * r, size_t n ) const;
+    void ceil( const T * x, T * r, size_t n ) const;
+    void trunc( const T * x, T * r, size_t n ) const;
+    void round( const T * x, T * r, size_t n ) const;
+    void add( const T * x, const T * y, T * r, size_t n ) const;
+    void sub( const T * x, const T * y, T * r, size_t n ) const;
+    void fma( const T * x, const T * y, const T * addend, T * r, size_t n ) const;
+    void mul( const T * x, const T * y, T * r, size_t n ) const;
+    void sqr( const T * x, T * r, size_t n ) const;
+    void fda( const T * y, const T * x, const T * addend, T * r, size_t n ) const;
+    void div( const T * y, const T * x, T * r, size_t n ) const;
+    void remainder( const T * y, const T * x, T * r, size_t n ) const;
+    void fmod( const T * y, const T * x, T * r, size_t n ) const;
+    void rcp( const T * x, T * r, size_t n ) const;
+    void fdim( const T * x, const T * y, T * r, size_t n ) const;
+    void fmax( const T * x, const T * y, T * r, size_t n ) const;
+    void fmin( const T * x, const T * y, T * r, size_t n ) const;
+
+    //-----------------------------------------------------
+    // Parallel Array Versions
+    //
+    //     ThreadPool pool;
+    //     cordic.parallel( pool ).exp( x, r, n );
+    //
+    // parallel() returns a lightweight proxy with the same array functions as above.
+    // Each call splits [0, n) into chunks of grain elements and runs the array version
+    // of the function on each chunk across the pool.  Results are identical to the array versions.
+    //
+    // The calling thread's rounding mode (fegetround()) is used by all chunks.  That override
+    // applies only to this Cordic, and fesetround() on it from inside a chunk changes only
+    // that chunk's thread.  If chunks of two Cordics nest on one thread, the innermost one applies.
+    // If the calling thread has a logger installed, the call runs on the calling thread only
+    // so that the log is complete and in order.
+    //-----------------------------------------------------
+    class Parallel
+    {
+    public:
+        Parallel( const Cordic<T,FLT,CORE> * cordic, ThreadPool * pool, size_t grain );
+
+        #define _pdecl_1( name )   void name( const T * x, T * r, size_t n ) const;
+        #define _pdecl_2( name )   void name( const T * x, const T * y, T * r, size_t n ) const;
+        #define _pdecl_3( name )   void name( const T * x, const T * y, const T * z, T * r, size_t n ) const;
+        #define _pdecl_1_2( name ) void name( const T * x, T * r1, T * r2, size_t n ) const;
+        #define _pdecl_2_2( name ) void name( const T * x, const T * y, T * r1, T * r2, size_t n ) const;
+        _CORDIC_ARRAY_FUNCS( _pdecl_1, _pdecl_2, _pdecl_3, _pdecl_1_2, _pdecl_2_2 )
+        #undef _pdecl_1
+        #undef _pdecl_2
+        #undef _pdecl_3
+        #undef _pdecl_1_2
+        #undef _pdecl_2_2
+
+    private:
+        const Cordic<T,FLT,CORE> * cordic;
+        ThreadPool *          pool;
+        size_t                grain;
+
+        template< typename FN >
+        void run( size_t n, const FN& fn ) const;                      // fn( begin, end ) on chunks
+    };
+
+    Parallel parallel( ThreadPool& pool, size_t grain=4096 ) const;
+
+    //-----------------------------------------------------
+    // Precision Scope
+    //
+    //     {
+    //         auto p = cordic.precision( 12 );
+    //         r = cordic.sin( x );                 // about 12 good fraction bits, but faster
+    //     }
+    //
+    // While the returned object is alive, this Cordic runs only enough CORDIC iterations
+    // on the calling thread for about bits good fraction bits (n becomes min(n, bits+4),
+    // and shortcut_i shrinks to match).  The encoding doesn't change, so values can be mixed
+    // freely with full-precision ones.  Scopes nest, the innermost one applies and only to
+    // its own Cordic, and Parallel passes the caller's precision on to all chunks.
+    // In correctly-rounded mode, the scope makes each call skip the fast path and go
+    // straight to the wider retry, so results stay correctly rounded but get slower.
+    //-----------------------------------------------------
+    class Precision
+    {
+    public:
+        Precision( const Cordic<T,FLT,CORE> * cordic, uint32_t bits );
+        ~Precision();
+        Precision( const Precision& ) = delete;
+        Precision& operator = ( const Precision& ) = delete;
+
+    private:
+        const Cordic<T,FLT,CORE> * prev_cordic;
+        uint32_t              prev_bits;
+    };
+
+    Precision precision( uint32_t bits ) const;
+
     //-----------------------------------------------------
     // Bob's Collection of Math Identities (some are used in the implementation, most are not)
     //
@@ -443,6 +670,34 @@ public:
 
     //-----------------------------------------------------
     // The basic CORDIC functions that all the above math functions ultimately use.
+    //
+    // When CORE fixes the format at compile time (see StaticCordic.h), these run CORE's
+    // fully unrolled iterations instead of their loops.
+    //
+    // With radix=4, circular_rotation() and hyperbolic_rotation() pick a digit from {-2,-1,0,1,2}
+    // per step, which takes about half as many steps.  The scale factor then depends on the
+    // digits chosen; it comes from one table lookup per four of the leading steps and is applied 
+    // once at the end, and the results have the same (radix-2) gain as documented below.  
+    // The vectoring modes always use radix 2.
+    //
+    // With shortcut_i != 0, the circular and hyperbolic modes stop after iteration shortcut_i.
+    // By then |z| (rotation) or |y/x| (vectoring) is below about 2^(-shortcut_i), so sin(z)=z and
+    // cos(z)=1 to within the fixed-point lsb once shortcut_i >= (frac_w+guard_w)/2.  Rotation
+    // finishes with one multiply by z, vectoring with one divide y/x (the _xy versions just stop).
+    // The default (-1) is (frac_w+guard_w+1)/2 + 1, which keeps the same ulp bound.
+    // The linear modes and radix=4 rotations ignore shortcut_i.
+    //
+    // With sincos_lut_w=k != 0, the sin/cos family does not start circular_rotation() at iteration 0.
+    // Instead, the top k bits of the reduced angle (0 .. PI/4) pick one of 2^k table entries
+    // holding (cos(a),sin(a)) for the middle a of that slice, and the CORDIC loop resolves only
+    // the remaining angle, starting at iteration k+2.  The table costs 3*2^k T values.
+    //
+    // exp_log_lut_w=k != 0 does the same for the exp and log families.  exp() starts hyperbolic_rotation()
+    // from the table value exp(a) for the middle a of the k-bit slice of 0 .. log(2) that the reduced
+    // argument falls in.  log() multiplies its reduced argument m (1 .. 2) by a table value 1/c for the
+    // middle c of m's k-bit slice, so that w=m/c is within 2^-(k+1) of 1, and adds log(c) to
+    // 2*atanh((w-1)/(w+1)) from hyperbolic_vectoring().  Both start at iteration k+2 and need no divide.
+    // The tables cost 4*2^k T values.
     //-----------------------------------------------------
 
     // circular rotation mode results after step n:
@@ -551,6 +806,24 @@ public:
     //
     void linear_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
 
+    //-----------------------------------------------------
+    // Batch versions of the above.
+    //
+    // Each runs the same iterations as its scalar version on cnt independent
+    // (x0[k], y0[k], z0[k]) triples and writes (x[k], y[k], z[k]); outputs may be the same arrays as inputs.
+    // The direction for each lane is chosen using a sign mask rather than a branch.
+    // When T is int64_t and the compiler targets AVX-512 (or AVX2), 8 (or 4) lanes are done per instruction.
+    // Results are bit-identical to the scalar versions in Cordic.
+    //-----------------------------------------------------
+    void circular_rotation( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+    void circular_vectoring( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+    void circular_vectoring_xy( size_t cnt, const T * x0, const T * y0, T * x, T * y ) const;
+    void hyperbolic_rotation( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+    void hyperbolic_vectoring( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+    void hyperbolic_vectoring_xy( size_t cnt, const T * x0, const T * y0, T * x, T * y ) const;
+    void linear_rotation( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+    void linear_vectoring( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+
     //-----------------------------------------------------
     // These version are used internally, but making them available publically.
     // In general, you should only call the earlier routines.
@@ -559,6 +832,7 @@ public:
     T    add( const T& x, const T& y, bool is_final ) const;                 
     T    sub( const T& x, const T& y, bool is_final ) const;                 
     T    scalbn( const T& x, int y, bool is_final ) const;                             
+    T    pown( const T& x, int n, bool is_final ) const;
     T    fma_fda( bool is_fma, const T& x, const T& y, const T& addend, bool is_final ) const;
     T    mul( const T& x, const T& y, bool is_final ) const;                 
     T    mulc( const T& x, const T& c, bool is_final ) const;
@@ -566,14 +840,24 @@ public:
     T    div( const T& y, const T& x, bool is_final ) const;                  
     T    sqrt( const T& x, bool is_final ) const;                              
     T    exp( const T& x, bool is_final, FLT b=M_E ) const;                              
+    T    log2( const T& x, bool is_final ) const;
     T    log( const T& x, bool is_final ) const;                             
     T    log1p( const T& x, bool is_final ) const;                          
     T    hypot( const T& x, const T& y, bool is_final ) const;          
     T    hypoth( const T& x, const T& y, bool is_final ) const;          
     T    atan2(  const T& y, const T& x, bool is_final, bool x_is_one, T * r ) const; 
     T    atanh2( const T& y, const T& x, bool is_final, bool x_is_one ) const; 
+    T    asinh_acosh( bool is_acosh, const T& x ) const;
     void sincos( bool times_pi, const T& x, T& si, T& co, bool is_final, bool need_si, bool need_co, const T * r ) const;
+    T    tan( bool times_pi, const T& x ) const;
+    T    asin_acos( bool is_acos, const T& x ) const;
     void sinhcosh( const T& x, T& sih, T& coh, bool is_final, bool need_sih, bool need_coh, const T * r ) const;
+    void sincos_finish( T& si, T& co, uint32_t quadrant, bool x_sign, bool did_minus_pi_div_4, 
+                        bool is_final, bool need_si, bool need_co, int32_t r_exp, bool r_sign, const T * r ) const;
+
+    static constexpr size_t ARRAY_BLOCK = 64;                           // elements per block in array versions
+    void sincos_array( bool times_pi, const T * x, T * si, T * co, size_t n, bool is_final, bool need_si, bool need_co ) const;
+    void exp_array( FLT b, const T * x, T * r, size_t n ) const;
 
     //-----------------------------------------------------
     // Argument Range Reduction Routines
@@ -611,10 +895,13 @@ public:
     void reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& y_sign ) const; 
     void reduce_mul_div_args( bool is_fma, T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& sign ) const; 
     void reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign ) const;
+    void reduce_r_arg( const T * _r, T& r, EXP_CLASS& r_exp_class, int32_t& r_exp, bool& r_sign ) const;
+    void reduce_cbrt_arg( bool is_rcbrt, T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, T& scale ) const;
     void reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign ) const;
     void reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend ) const;
     void reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class, int32_t& exp, bool& swapped ) const;
     void reduce_sincos_arg( bool times_pi, T& a, uint32_t& quadrant, EXP_CLASS& exp_class, bool& sign, bool& did_minus_pi_div_4 ) const;
+    bool reduce_sincos_arg_int( bool times_pi, T& a, uint64_t& i ) const;
 
     //-----------------------------------------------------
     // Logging Support
@@ -623,8 +910,8 @@ public:
     // You can use the default Logger (new Logger<T,FLT>( ... )) or supply your 
     // own Logger subclass.  
     //
-    // NOTE: Logging is done globally, not just for one Cordic.  
-    //       Thus the static methods here.
+    // NOTE: Logging is done per thread for all Cordics, not just for one Cordic.  
+    //       Thus the static methods here.  A logger set on one thread is not seen by other threads.
     //-----------------------------------------------------
     static void            logger_set( Logger<T,FLT> * logger );  // null means use the default logger
     static Logger<T,FLT> * logger_get( void );                    // returns current logger
@@ -710,6 +997,8 @@ public:
         exp2,
         exp10,
         pow,
+        pown,
+        rootn,
         log,
         log1p,
         logn,
@@ -756,6 +1045,49 @@ public:
 
     static constexpr uint32_t OP_cnt = uint32_t(OP::dram_wr) + 1;
 
+    //-----------------------------------------------------
+    // Function Backends
+    //
+    // The math functions above reduce their arguments to one of these kernels:
+    //
+    //     kernel            range                      set through
+    //     ---------------   ------------------------   -------------------------------------------------------------
+    //     cos(a), sin(a)    0 <= a <= PI/4             sin cos sincos sinpi cospi sinpicospi tan tanpi polar_to_rect
+    //     exp(a)            0 <= a < log(2)            exp expm1 expc exp2 exp10
+    //     log(m/2)          1 <= m < 2                 log logn logc log10
+    //     atan(t)           0 <= t <= 1                atan atan2 rect_to_polar
+    //
+    // fn_backend_set() picks how op's kernel is computed, so all the functions that share it switch
+    // together (pow and rootn also use the exp and log kernels, asinh and acosh the log kernel, and
+    // log2 the log kernel for 1/2 <= x < 1).
+    // CORDIC is the default and stays the bit-exact reference for hardware.  POLY sums one Chebyshev
+    // series over the whole range; TABLE splits the range into 2^FN_TABLE_W pieces with a short series
+    // each.  Truncated Chebyshev series are within a whisker of the minimax polynomials, and the degree
+    // is the lowest that keeps the error below 2^-(frac_w+guard_w+2) (or FLT's precision).  Both are
+    // evaluated in fixed-point and their results go through the same reconstruct() and rfrac(), so
+    // only the kernel's error differs.  The coefficients are computed here, so set backends up front.
+    // If POLY would need a degree above FN_POLY_DEG_MAX, fn_backend_set() returns false and leaves
+    // the kernel's backend as it was; pick TABLE (or stay with CORDIC) then.  A Precision scope does
+    // not shorten POLY or TABLE.
+    //
+    // Where each pays off: TABLE is the fastest, at 2^FN_TABLE_W times POLY's
+    // coefficients.  POLY is for when that memory matters.  It stays well ahead of CORDIC while its
+    // degree is low: in the 1.11.40 format, sin/cos and exp need degree 11 and take about half of
+    // CORDIC's time (TABLE 40-50%), while log and atan would need 17 and 20 and are refused.  In the
+    // 1.8.23 format every kernel fits and POLY is close behind TABLE.
+    //-----------------------------------------------------
+    enum class FN_BACKEND
+    {
+        CORDIC,                         // CORDIC iterations (with the sincos or exp/log table, if any)
+        POLY,                           // one Chebyshev series over the kernel's range
+        TABLE,                          // table of 2^FN_TABLE_W Chebyshev series, one per piece of the range
+    };
+    static constexpr uint32_t FN_TABLE_W      = 6;          // TABLE has 2^FN_TABLE_W pieces
+    static constexpr uint32_t FN_POLY_DEG_MAX = 16;         // fn_backend_set() refuses POLY above this degree
+
+    bool       fn_backend_set( OP op, FN_BACKEND backend );       // backend for op's kernel; false if POLY would be too long; ops with no kernel only take CORDIC
+    FN_BACKEND fn_backend_get( OP op ) const;                     // backend for op's kernel (CORDIC if no kernel)
+
 
 
 
@@ -803,7 +1135,39 @@ private:
     int32_t                     _exp_unbiased_max;
     uint32_t                    _w;
     uint32_t                    _n;
+    uint32_t                    _radix;
+    uint32_t                    _shortcut_i;
+    BACKEND                     _arith_backend;
     int                         _rounding_mode;
+    static constexpr int32_t    CR_ERR_W = 6;                            // see correctly_rounded_set()
+    static constexpr uint32_t   CR_LEVEL_MAX = 4;                        // most retry Cordics
+    static constexpr uint32_t   CR_LEVEL_W = 16;                         // guard bits added per retry Cordic
+    uint32_t                    _cr_level_cnt;                           // number of retry Cordics (0 == mode is off)
+    Cordic<T,FLT> *             _cr_cordic[CR_LEVEL_MAX];                // ever wider Cordics for the correctly-rounded retries (default CORE)
+    uint32_t                    _cr_delta_w[CR_LEVEL_MAX];               // their extra guard bits
+    int32_t                     _cr_err_w;                               // log2 of the error in guard lsbs for results in [1,2)
+    bool                        _cr_fast;                                // _cr_err_w leaves room for the fast path
+
+    enum class FN_KERNEL                                                 // see fn_backend_set()
+    {
+        SINCOS,
+        EXP,
+        LOG,
+        ATAN,
+        NONE,
+    };
+    static constexpr uint32_t   FN_KERNEL_CNT = uint32_t(FN_KERNEL::NONE);
+    struct FN_APPROX                                                     // piecewise Chebyshev series for one kernel function
+    {
+        T                       lo;                                      // start of the range
+        uint32_t                piece_shift;                             // piece is (x - lo) >> piece_shift
+        uint32_t                piece_cnt;                               // number of pieces
+        uint32_t                u_shift;                                 // u = ((x - piece start) << u_shift) - 1 is in -1 .. 1
+        uint32_t                deg;                                     // degree of every piece
+        T *                     coef;                                    // per piece: deg+1 Chebyshev coefficients (nullptr == not built)
+    };
+    FN_BACKEND                  _fn_backend[FN_KERNEL_CNT];              // per kernel
+    FN_APPROX                   _fn_approx[FN_KERNEL_CNT][2];            // per kernel: its functions (SINCOS: cos, sin)
 
     T                           _quiet_NaN_fxd;
     T                           _maxint;
@@ -821,6 +1185,7 @@ private:
     T                           _half_fxd;
     T                           _one;
     T                           _one_fxd;
+    int32_t                     _one_fxd_clz;                            // clz( _one_fxd )
     T                           _neg_one;
     T                           _two;
     T                           _two_fxd;
@@ -859,29 +1224,238 @@ private:
     T                           _hyperbolic_vectoring_one_over_gain;     // hyperbolic vectoring 1/gain
     T                           _hyperbolic_angle_max_fxd;               // hyperbolic vectoring |z0| max value
 
-    static Logger<T,FLT> * logger;
+    uint32_t                    _circular_r4_cnt;                        // radix-4 circular rotation steps
+    uint32_t                    _circular_r4_scale_cnt;                  // leading steps whose scale factors are not 1
+    T *                         _circular_r4_fxd;                        // per step: atan(1*4^-j), atan(2*4^-j), and the two digit thresholds
+    T *                         _circular_r4_scale_fxd;                  // per group of R4_SCALE_GROUP_N steps: product of their scales for each digit magnitude combination
+    uint32_t                    _hyperbolic_r4_cnt;                      // radix-4 hyperbolic rotation steps after the radix-2 prefix
+    uint32_t                    _hyperbolic_r4_scale_cnt;                // leading steps whose scale factors are not 1
+    T *                         _hyperbolic_r4_fxd;                      // per step: atanh(1*2^-s), atanh(2*2^-s), and the two digit thresholds
+    T *                         _hyperbolic_r4_scale_fxd;                // same as _circular_r4_scale_fxd
+    static constexpr uint32_t   R4_SCALE_GROUP_N = 4;                    // steps per scale group
+    static constexpr uint32_t   R4_SCALE_GROUP_SIZE = 81;                // 3^R4_SCALE_GROUP_N digit magnitude combinations
+
+    uint32_t                    _sincos_lut_w;                           // log2 of sincos table entries (0 == no table)
+    uint32_t                    _sincos_lut_first_i;                     // first circular iteration after the table lookup
+    T *                         _sincos_lut_fxd;                         // per entry: cos(a)/gain, sin(a)/gain, a  (gain of remaining iterations)
+    T                           _four_div_pi_fxd;                        // 4/PI
+    uint64_t *                  _four_div_pi_bits;                       // 4/PI bits, msb first, enough for _exp_unbiased_max (nullptr == use mulc())
+
+    static constexpr uint32_t   TWO_DIV_PI_24[66] = {                    // 2/PI bits 24 at a time (fdlibm's two_over_pi[])
+        0xA2F983, 0x6E4E44, 0x1529FC, 0x2757D1, 0xF534DD, 0xC0DB62, 0x95993C, 0x439041,
+        0xFE5163, 0xABDEBB, 0xC561B7, 0x246E3A, 0x424DD2, 0xE00649, 0x2EEA09, 0xD1921C,
+        0xFE1DEB, 0x1CB129, 0xA73EE8, 0x8235F5, 0x2EBB44, 0x84E99C, 0x7026B4, 0x5F7E41,
+        0x3991D6, 0x398353, 0x39F49C, 0x845F8B, 0xBDF928, 0x3B1FF8, 0x97FFDE, 0x05980F,
+        0xEF2F11, 0x8B5A0A, 0x6D1F6D, 0x367ECF, 0x27CB09, 0xB74F46, 0x3F669E, 0x5FEA2D,
+        0x7527BA, 0xC7EBE5, 0xF17B3D, 0x0739F7, 0x8A5292, 0xEA6BFB, 0x5FB11F, 0x8D5D08,
+        0x560330, 0x46FC7B, 0x6BABF0, 0xCFBC20, 0x9AF436, 0x1DA9E3, 0x91615E, 0xE61B08,
+        0x659985, 0x5F14A0, 0x68408D, 0xFFD880, 0x4D7327, 0x310606, 0x1556CA, 0x73A8C9,
+        0x60E27B, 0xC08C6B
+    };
+    static constexpr uint64_t   PI_DIV_4_U64 = 0xC90FDAA22168C234ULL;    // PI/4 * 2^64
+
+    uint32_t                    _exp_log_lut_w;                          // log2 of exp and log table entries (0 == no tables)
+    uint32_t                    _exp_log_lut_first_i;                    // first hyperbolic iteration after the table lookup
+    T *                         _exp_lut_fxd;                            // per entry: exp(a)/gain, a  (gain of remaining iterations)
+    T *                         _log_lut_fxd;                            // per entry: 1/c, log(c/2)
+    T                           _one_div_log2_fxd;                       // 1/log(2)
+    T                           _log2_fxd;                               // log(2)
+
+    enum class MULC                                                      // constants with a mulc() plan, see mulc_plan_set()
+    {
+        hyperbolic_vectoring_one_over_gain,
+        hyperbolic_rotation_one_over_gain,
+        circular_vectoring_one_over_gain,
+        circular_rotation_one_over_gain,
+        third,
+        neg_third,
+        sqrt2_div_2,
+        pi,
+        one_div_pi,
+        two_div_pi,
+        pi_div_2,
+        four_div_pi,
+        pi_div_4,
+        log2,
+        log10,
+        one,
+        deg_per_pi,                                                      // 180
+        pi_per_deg,                                                      // 1/180
+        one_div_log2,                                                    // 1/log(2)
+        e_log2_b,                                                        // _base_e.log2_b
+        e_one_div_log_b,                                                 // _base_e.one_div_log_b
+        ten_log2_b,                                                      // _base_10.log2_b
+        ten_one_div_log_b,                                               // _base_10.one_div_log_b
+        CNT
+    };
+    static constexpr uint32_t   MULC_CNT = uint32_t(MULC::CNT);
+    struct MULC_PLAN
+    {
+        T                       c;                                       // encoded constant
+        int32_t                 c_exp;                                   // its unbiased exponent
+        bool                    c_sign;                                  // its sign
+        uint32_t                digit_cnt;                               // nonzero digits of its mantissa (0 == no plan, use mul())
+        int32_t                 digit_shift[sizeof(T)*8];                // mantissa(c) = sum of +/-2^-digit_shift[i]
+        bool                    digit_neg[sizeof(T)*8];                  // digit is -1
+    };
+    MULC_PLAN *                 _mulc_plan;                              // indexed by MULC
+    int32_t                     _mulc_headroom_w;                        // extra low bits kept while summing
+    void                        mulc_plan_set( MULC k, const T& c );     // recode c into _mulc_plan[k]
+    void                        mulc_plan_build( MULC_PLAN& plan, const T& c ) const;                          // recode c into plan
+    T                           mulc( const T& x, MULC c, bool is_final ) const;                               // c's plan is known
+    T                           mulc( const T& x, const T& c, const MULC_PLAN * plan, bool is_final ) const;   // plan == nullptr: mul()
+
+    struct BASE_CONSTS                                                   // per-base constants for expc() and logc()
+    {
+        FLT                     b;
+        T                       log2_b;                                  // log2(b)
+        T                       one_div_log_b;                           // 1/log(b)
+        const MULC_PLAN *       log2_b_plan;                             // mulc() plans for those
+        const MULC_PLAN *       one_div_log_b_plan;
+        MULC_PLAN               plan[2];                                 // where they are for bases other than e and 10
+    };
+    BASE_CONSTS                 _base_e;                                 // b=e
+    BASE_CONSTS                 _base_10;                                // b=10
+    static constexpr uint32_t   BASE_OTHER_CNT = 4;
+    mutable BASE_CONSTS         _base_other[BASE_OTHER_CNT];             // the first other bases used, filled under the mutex
+    mutable std::atomic<uint32_t> _base_other_cnt;                       // entries below this are filled and never change
+    mutable std::mutex          _base_other_mutex;
+    const BASE_CONSTS&          base_consts( FLT b, BASE_CONSTS& scratch ) const;  // constants for b (in scratch once the table is full)
+
+    T                           _third_fxd;                              // 1/3
+    T                           _cbrt_fxd[3];                            // 2^(j/3) for j=0..2
+    T                           _rcbrt_seed_fxd[3];                      // c0 + c1*m + c2*m^2 ~= m^(-1/3) for 1 <= m < 2
+    T                           _asin_series_fxd[6];                     // asin(v)/v = 1 + c0*v^2 + c1*v^4 + ... + c5*v^12 + ...
+    uint32_t                    _atanh_series_cnt;                       // enough terms for |u| <= 1/3
+    T *                         _atanh_series_fxd;                       // atanh(u)/u = 1 + c0*u^2 + c1*u^4 + ... (cj = 1/(2j+3))
+    uint32_t                    _sinhcosh_series_cnt;                    // enough terms for |v| < 1/2
+    T *                         _inv_fact_fxd;                           // 1/k! for k = 0 .. 2*_sinhcosh_series_cnt-1
+
+
+    void rotation_radix4( bool is_hyperbolic, const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const;
+    T    mul_fxd( const T& x, const T& y ) const;                         // fixed-point x*y, rounded
+    T    div_fxd( const T& y, const T& x ) const;                         // fixed-point y/x, |y/x| < 2
+    T    div_fxd_nr( const T& y, const T& x ) const;                      // fixed-point y/x using Newton-Raphson 1/x, 1 <= x < 2
+    T    ratio_fxd( const T& y, const T& x, int32_t& exp ) const;         // fixed-point y/x = ratio*2^exp, 0 < y, 0 < x, using the arith backend
+    int32_t clz( const T& x ) const;                                      // leading zero bits of x >= 0
+    void circular_rotation_lut( const T& z0, T& x, T& y ) const;          // sincos() rotation of the 1/gain vector using the sincos table
+    T    exp_lut( const T& z0 ) const;                                    // fixed-point exp(z0)   for 0 <= z0 < log(2) using the exp table
+    T    log_lut( const T& m ) const;                                     // fixed-point log(m/2)  for 1 <= m  < 2      using the log table
+    T    log_fxd( const T& m ) const;                                     // fixed-point log(m/2)  for 1 <= m  < 2
+    T    exp_fxd( const T& a ) const;                                     // fixed-point exp(a)    for 0 <= a  < log(2)
+    void sincos_fxd( const T& a, T& co, T& si ) const;                    // fixed-point cos(a) and sin(a) for 0 <= a <= PI/4
+    static FN_KERNEL fn_kernel( OP op );                                  // kernel that op's backend applies to
+    template< typename F >
+    void fn_approx_build( FN_APPROX& a, F f, FLT lo, FLT hi, uint32_t piece_w );  // fit f on lo .. hi with 2^piece_w pieces
+    T    fn_approx_eval( const FN_APPROX& a, const T& x ) const;          // fixed-point f(x) from its FN_APPROX
+    T    rcbrt_fxd( const T& m ) const;                                   // fixed-point m^(-1/3)  for 1 <= m  < 2
+    T    sqrt_fxd( const T& u, int32_t& e ) const;                        // fixed-point sqrt(u) = r*2^e, 1 <= r < 2, for 0 < u
+    T    asin_fxd( const T& t ) const;                                    // fixed-point asin(t)   for 0 <= t <= 1/2  using double rotations
+    T    asin_fxd( const T& m, int32_t& e ) const;                        // asin(m*2^e) = r*2^e, e stays put if m*2^e is tiny, else becomes 0
+    T    atanh_fxd( const T& m, int32_t e ) const;                         // atanh(m*2^e) = r*2^e  for 0 < m*2^e <= 1/3  using the series
+    void sinhcosh_series_fxd( const T& m, int32_t e, T& sih, T& coh ) const;  // sinh(m*2^e) = sih*2^e, cosh(m*2^e) = coh  for |m*2^e| < 1/2
+    void sinhcosh_fxd( const T& x_orig, T x, int32_t x_exp, const T& r,  // fixed-point r*exp(f)/2 and r*exp(-f)/2^(2i+1)
+                       T& e_pos, T& e_neg, int32_t& i ) const;            //    where |x| = i*log(2) + f
+    T    cbrt_rcbrt( bool is_rcbrt, const T& x ) const;                   // cbrt() or rcbrt()
+    T    pown_fxd( const T& m, int64_t n, int64_t& e ) const;             // m^n = r*2^e, 1 <= r < 2, for 1 <= m < 2
+    bool isint( const T& x, int& n ) const;                               // true if x is an integer that fits in an int
+
+    enum class KIND
+    {
+        CIRCULAR,
+        HYPERBOLIC,
+        LINEAR,
+    };
+
+    static constexpr size_t BATCH_LANES = 8;                            // lanes per block in portable batch code
+
+    template< KIND kind, bool is_vectoring >
+    void batch( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+    template< KIND kind, bool is_vectoring >
+    void batch_block( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+#if defined(__AVX512F__)
+    template< KIND kind, bool is_vectoring >
+    size_t batch_avx512( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+#elif defined(__AVX2__)
+    template< KIND kind, bool is_vectoring >
+    size_t batch_avx2( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const;
+#endif
+
+    using CordicLogging<T,FLT>::logger;
+    static thread_local const Cordic *  _thread_rounding_cordic;// Cordic whose rounding mode is overridden on this thread, if any; see Parallel
+    static thread_local int             _thread_rounding_mode;  // its mode
+    static thread_local const Cordic *  _thread_prec_cordic;    // Cordic with a Precision scope on this thread, if any
+    static thread_local uint32_t        _thread_prec_bits;      // its bits
+    static thread_local bool            _thread_cr_busy;        // inside a correctly-rounded call, so nested calls run as usual
+
+    int32_t cr_err_w( const T& r, int32_t extra_w ) const;
+    bool cr_is_ambiguous( const T& r, int rmode, int32_t err_w ) const;
+    void cr_snap( T& r, int rmode ) const;
+    template< typename FN, typename COND_W >
+    void cr_eval( const T * args, uint32_t cnt, int n, T * r, uint32_t r_cnt,        // r[0..r_cnt-1] = fn( c, args[0..cnt-1], n, r ) correctly rounded
+                  FN fn, COND_W cond_w ) const;                                       // cond_w( c, r ): extra error bits for ill-conditioned results
+
+    template< typename, typename, typename > friend class Cordic;     // cr_eval() uses the default-CORE levels' internals
+
+    //-----------------------------------------------------
+    // The format fields that deconstruct(), reconstruct(), and add() use,
+    // as compile-time constants when CORE fixes the format.
+    //-----------------------------------------------------
+    #define _fmt_decl( type, name ) \
+        type fmt_##name( void ) const { if constexpr ( CORE::is_static ) return CORE::name##_c; else return _##name; }
+    _fmt_decl( bool,     is_float )
+    _fmt_decl( uint32_t, w )
+    _fmt_decl( uint32_t, exp_w )
+    _fmt_decl( uint32_t, frac_guard_w )
+    _fmt_decl( const T&, frac_guard_mask )
+    _fmt_decl( uint32_t, exp_mask )
+    _fmt_decl( int32_t,  exp_bias )
+    _fmt_decl( int32_t,  exp_unbiased_min )
+    _fmt_decl( int32_t,  exp_unbiased_max )
+    _fmt_decl( const T&, one_fxd )
+    _fmt_decl( int32_t,  one_fxd_clz )
+    _fmt_decl( const T&, two_fxd )
+    _fmt_decl( const T&, four_fxd )
+    _fmt_decl( const T&, quiet_NaN_fxd )
+    #undef _fmt_decl
+
+protected:
+    uint32_t iter_n( uint32_t n ) const;                        // n limited by any Precision scope
+    uint32_t iter_shortcut_n( void ) const;                     // last i for the loops that can end with the shortcut
 };
 
 //-----------------------------------------------------
 // Logging
 //-----------------------------------------------------
-template< typename T, typename FLT >
-Logger<T,FLT> * Cordic<T,FLT>::logger = nullptr;
+template< typename T, typename FLT, typename CORE >
+thread_local const Cordic<T,FLT,CORE> * Cordic<T,FLT,CORE>::_thread_rounding_cordic = nullptr;
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::logger_set( Logger<T,FLT> * _logger )
+template< typename T, typename FLT, typename CORE >
+thread_local int Cordic<T,FLT,CORE>::_thread_rounding_mode = FE_TONEAREST;
+
+template< typename T, typename FLT, typename CORE >
+thread_local const Cordic<T,FLT,CORE> * Cordic<T,FLT,CORE>::_thread_prec_cordic = nullptr;
+
+template< typename T, typename FLT, typename CORE >
+thread_local uint32_t Cordic<T,FLT,CORE>::_thread_prec_bits = 0;
+
+template< typename T, typename FLT, typename CORE >
+thread_local bool Cordic<T,FLT,CORE>::_thread_cr_busy = false;
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::logger_set( Logger<T,FLT> * _logger )
 {
     logger = _logger;
 }    
 
-template< typename T, typename FLT >
-Logger<T,FLT> * Cordic<T,FLT>::logger_get( void )
+template< typename T, typename FLT, typename CORE >
+Logger<T,FLT> * Cordic<T,FLT,CORE>::logger_get( void )
 {
     return logger;
 }    
 
-template< typename T, typename FLT >
-std::string Cordic<T,FLT>::op_to_str( uint16_t op )
+template< typename T, typename FLT, typename CORE >
+std::string Cordic<T,FLT,CORE>::op_to_str( uint16_t op )
 {
     #define _ocase( op ) case OP::op: return #op;
     
@@ -953,6 +1527,8 @@ std::string Cordic<T,FLT>::op_to_str( uint16_t op )
         _ocase( exp2 )
         _ocase( exp10 )
         _ocase( pow )
+        _ocase( pown )
+        _ocase( rootn )
         _ocase( log )
         _ocase( logn )
         _ocase( log1p )
@@ -999,23 +1575,81 @@ std::string Cordic<T,FLT>::op_to_str( uint16_t op )
 }
 
 #define _log_1( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), &opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1 )
 #define _log_1i( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), opnd1 )
 #define _log_1b( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), opnd1 )
 #define _log_1f( op, opnd1 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op1( uint16_t(Cordic<T,FLT>::OP::op), opnd1 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op1( uint16_t(Cordic<T,FLT,CORE>::OP::op), opnd1 )
 #define _log_2( op, opnd1, opnd2 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op2( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, &opnd2 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op2( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, &opnd2 )
 #define _log_2i( op, opnd1, opnd2 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op2( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, opnd2 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op2( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, opnd2 )
 #define _log_2f( op, opnd1, opnd2 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op2( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, opnd2 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op2( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, opnd2 )
 #define _log_3( op, opnd1, opnd2, opnd3 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op3( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, &opnd2, &opnd3 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op3( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, &opnd2, &opnd3 )
 #define _log_4( op, opnd1, opnd2, opnd3, opnd4 ) \
-            if ( Cordic<T,FLT>::logger != nullptr ) Cordic<T,FLT>::logger->op4( uint16_t(Cordic<T,FLT>::OP::op), &opnd1, &opnd2, &opnd3, &opnd4 )
+            if ( Cordic<T,FLT,CORE>::logger != nullptr ) Cordic<T,FLT,CORE>::logger->op4( uint16_t(Cordic<T,FLT,CORE>::OP::op), &opnd1, &opnd2, &opnd3, &opnd4 )
+#define _cr_1( name, opnd1 ) _cr_1c( name, opnd1, _cr_no_w )
+#define _cr_2( name, opnd1, opnd2 ) _cr_2c( name, opnd1, opnd2, _cr_no_w )
+#define _cr_on() (_cr_level_cnt != 0 && !_thread_cr_busy && Cordic<T,FLT,CORE>::logger == nullptr)
+#define _cr_1c( name, opnd1, cond_w ) \
+            if ( _cr_on() ) { \
+                const T _cr_args[1] = { opnd1 }; \
+                T _cr_res; \
+                cr_eval( _cr_args, 1, 0, &_cr_res, 1, []( const auto * _cr_c, const T * _cr_a, int, T * _cr_r ) \
+                                                      { _cr_r[0] = _cr_c->name( _cr_a[0] ); }, cond_w ); \
+                return _cr_res; \
+            }
+#define _cr_2c( name, opnd1, opnd2, cond_w ) \
+            if ( _cr_on() ) { \
+                const T _cr_args[2] = { opnd1, opnd2 }; \
+                T _cr_res; \
+                cr_eval( _cr_args, 2, 0, &_cr_res, 1, []( const auto * _cr_c, const T * _cr_a, int, T * _cr_r ) \
+                                                      { _cr_r[0] = _cr_c->name( _cr_a[0], _cr_a[1] ); }, cond_w ); \
+                return _cr_res; \
+            }
+#define _cr_3( name, opnd1, opnd2, opnd3 ) \
+            if ( _cr_on() ) { \
+                const T _cr_args[3] = { opnd1, opnd2, opnd3 }; \
+                T _cr_res; \
+                cr_eval( _cr_args, 3, 0, &_cr_res, 1, []( const auto * _cr_c, const T * _cr_a, int, T * _cr_r ) \
+                                                      { _cr_r[0] = _cr_c->name( _cr_a[0], _cr_a[1], _cr_a[2] ); }, _cr_no_w ); \
+                return _cr_res; \
+            }
+#define _cr_1n( name, opnd1, n ) \
+            if ( _cr_on() ) { \
+                const T _cr_args[1] = { opnd1 }; \
+                T _cr_res; \
+                cr_eval( _cr_args, 1, n, &_cr_res, 1, []( const auto * _cr_c, const T * _cr_a, int _cr_n, T * _cr_r ) \
+                                                      { _cr_r[0] = _cr_c->name( _cr_a[0], _cr_n ); }, _cr_no_w ); \
+                return _cr_res; \
+            }
+#define _cr_1_2( name, opnd1, res1, res2 ) \
+            if ( _cr_on() ) { \
+                const T _cr_args[1] = { opnd1 }; \
+                T _cr_res[2]; \
+                cr_eval( _cr_args, 1, 0, _cr_res, 2, []( const auto * _cr_c, const T * _cr_a, int, T * _cr_r ) \
+                                                     { _cr_c->name( _cr_a[0], _cr_r[0], _cr_r[1] ); }, _cr_no_w ); \
+                res1 = _cr_res[0]; \
+                res2 = _cr_res[1]; \
+                return; \
+            }
+#define _cr_2_2( name, opnd1, opnd2, res1, res2 ) \
+            if ( _cr_on() ) { \
+                const T _cr_args[2] = { opnd1, opnd2 }; \
+                T _cr_res[2]; \
+                cr_eval( _cr_args, 2, 0, _cr_res, 2, []( const auto * _cr_c, const T * _cr_a, int, T * _cr_r ) \
+                                                     { _cr_c->name( _cr_a[0], _cr_a[1], _cr_r[0], _cr_r[1] ); }, _cr_no_w ); \
+                res1 = _cr_res[0]; \
+                res2 = _cr_res[1]; \
+                return; \
+            }
+#define _cr_no_w   []( const auto *, const T& ) { return int32_t(0); }
+#define _cr_tan_w  []( const auto * c, const T& r ) { return std::max( c->ilogb( r ), 0 ); }                        // d/dx tan = 1 + tan^2
+#define _cr_atanh_w []( const auto * c, const T& r ) { return int32_t( 3 * std::fabs( c->to_flt( r ) ) ); }     // d/dx atanh = cosh^2(atanh)
 #define _logconst( c ) \
             constructed( c ); \
             _log_1f( push_constant, _to_flt(c) ); \
@@ -1024,8 +1658,8 @@ std::string Cordic<T,FLT>::op_to_str( uint16_t op )
 //-----------------------------------------------------
 // Constructor
 //-----------------------------------------------------
-template< typename T, typename FLT >
-Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint32_t guard_w, uint32_t n )
+template< typename T, typename FLT, typename CORE >
+Cordic<T,FLT,CORE>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint32_t guard_w, uint32_t n, uint32_t radix, uint32_t shortcut_i, uint32_t sincos_lut_w, uint32_t exp_log_lut_w, BACKEND arith_backend )
 {
     if ( n == uint32_t(-1) ) n = 1 + frac_w;
     if ( guard_w == uint32_t(-1) ) guard_w = std::ceil(std::log2(frac_w));
@@ -1034,6 +1668,14 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     cassert( (1+int_exp_w+frac_w+guard_w) <= (sizeof( T ) * 8), "1 + int_exp_w + frac_w + guard_w does not fit in T container" );
     cassert( int_exp_w != 0, "int_exp_w must be > 0" );
     cassert( frac_w    != 0, "frac_w must be > 0" );
+    cassert( radix == 2 || radix == 4, "radix must be 2 or 4" );
+    cassert( radix == 2 || n >= 5, "radix 4 requires n >= 5" );
+    if ( shortcut_i == uint32_t(-1) ) shortcut_i = (frac_w + guard_w + 1)/2 + 1;
+    cassert( shortcut_i < n, "shortcut_i must be < n" );
+    cassert( sincos_lut_w <= 16, "sincos_lut_w must be <= 16" );
+    cassert( sincos_lut_w == 0 || (sincos_lut_w + 2) < ((shortcut_i != 0) ? shortcut_i : n), "sincos_lut_w leaves no CORDIC iterations" );
+    cassert( exp_log_lut_w <= 16, "exp_log_lut_w must be <= 16" );
+    cassert( exp_log_lut_w == 0 || (exp_log_lut_w + 2) < ((shortcut_i != 0) ? shortcut_i : n), "exp_log_lut_w leaves no CORDIC iterations" );
 
     _is_float        = is_float;
     _int_w           = is_float ? 0         : int_exp_w;                
@@ -1045,10 +1687,14 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     _guard_mask      = (T(1) << _guard_w) - 1;
     _exp_mask        = is_float ? ((1 << int_exp_w)-1) : 0;
     _exp_bias        = is_float ? ((_exp_mask >> 1) - 1) : 0;
-    _exp_unbiased_min= is_float ? (0 - _exp_bias) : 0;
+    _exp_unbiased_min= is_float ? (1 - _exp_bias) : 0;            // smallest normal; subnormals share it
     _exp_unbiased_max= is_float ? ((1 << (int_exp_w-1))-1) : 0;
     _w               = 1 + int_exp_w + frac_w + guard_w;
     _n               = n;
+    _radix           = 2;                                               // gains etc. below are computed with radix 2
+    _shortcut_i      = 0;                                               // and with all n iterations
+    _arith_backend   = BACKEND::CORDIC;                                 // and with CORDIC mul/div
+    _mulc_plan       = nullptr;                                         // and with mulc() == mul()
     _rounding_mode   = FE_TONEAREST;
     _maxint          = is_float ? T(0) : ((T(1) << int_exp_w) - 1);
 
@@ -1057,6 +1703,7 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     _min_fxd         = T(1) << _guard_w;
     _half_fxd        = T(1) << (_frac_guard_w-1);
     _one_fxd         = T(1) << _frac_guard_w;                        
+    _one_fxd_clz     = clz( _one_fxd );
     _two_fxd         = T(2) << _frac_guard_w;
     _four_fxd        = T(4) << _frac_guard_w;
     _quiet_NaN_fxd   = T(1) << (_frac_guard_w-1);
@@ -1141,19 +1788,332 @@ Cordic<T,FLT>::Cordic( uint32_t int_exp_w, uint32_t frac_w, bool is_float, uint3
     if ( debug ) printf( "circular_vectoring_one_over_gain_fxd:         %016" FMT_LLX "   %.30f\n",  _circular_vectoring_one_over_gain_fxd, _to_flt(_circular_vectoring_one_over_gain_fxd, false, true) );
     if ( debug ) printf( "hyperbolic_rotation_one_over_gain_fxd:        %016" FMT_LLX "   %.30f\n",  _hyperbolic_rotation_one_over_gain_fxd, _to_flt(_hyperbolic_rotation_one_over_gain_fxd, false, true) );
     if ( debug ) printf( "hyperbolic_vectoring_one_over_gain_fxd:       %016" FMT_LLX "   %.30f\n",  _hyperbolic_vectoring_one_over_gain_fxd, _to_flt(_hyperbolic_vectoring_one_over_gain_fxd, false, true) );
+
+    // radix-4 tables
+    //
+    // circular:   step j uses shift s=2j,   j=0 .. (n+1)/2
+    // hyperbolic: radix-2 steps i=1,2,3,4,4 first, then step j uses shift s=5+2j, j=0 .. (n-4)/2
+    //
+    // Picking the nearest of the 5 angles leaves at most half the gap between two of them,
+    // which the remaining steps can always cover, so no steps need to be repeated.
+    // Nothing is built for radix 2.
+    //
+    // Each step scales the vector by 1/sqrt(1 +/- d^2*2^(-2s)), which depends only on |d|, and
+    // is 1 in fixed-point after the first few steps.  Those few are split into groups of R4_SCALE_GROUP_N
+    // steps, and each group gets the product of its scales for every combination of |d| in base 3,
+    // so a rotation does one multiply per group rather than one per step.  The radix-2 gain 
+    // (over the hyperbolic radix-2 prefix gain) is folded into the first group.
+    //
+    _circular_r4_cnt         = (radix == 4) ? ((n+1)/2 + 1) : 0;
+    _hyperbolic_r4_cnt       = (radix == 4) ? ((n-4)/2 + 1) : 0;
+    _circular_r4_fxd         = (radix == 4) ? new T[4*_circular_r4_cnt]   : nullptr;
+    _hyperbolic_r4_fxd       = (radix == 4) ? new T[4*_hyperbolic_r4_cnt] : nullptr;
+    _circular_r4_scale_fxd   = nullptr;
+    _hyperbolic_r4_scale_fxd = nullptr;
+    _circular_r4_scale_cnt   = 0;
+    _hyperbolic_r4_scale_cnt = 0;
+    for( uint32_t h = 0; h < 2 && radix == 4; h++ )
+    {
+        uint32_t& scale_cnt = h ? _hyperbolic_r4_scale_cnt : _circular_r4_scale_cnt;
+        uint32_t cnt   = h ? _hyperbolic_r4_cnt       : _circular_r4_cnt;
+        T *      a     = h ? _hyperbolic_r4_fxd       : _circular_r4_fxd;
+        FLT *    scale = new FLT[3*cnt];                            // per step: 1, then 1/sqrt(1 +/- t^2) for |d| = 1, 2
+        for( uint32_t j = 0; j < cnt; j++ )
+        {
+            uint32_t s    = h ? (5 + 2*j) : (2*j);
+            FLT      p2 = std::pow( FLT(2), -FLT(s) );
+            scale[3*j] = 1;
+            for( uint32_t m = 1; m <= 2; m++ )
+            {
+                FLT t   = FLT(m) * p2;
+                FLT ang = h ? std::atanh( t ) : std::atan( t );
+                a[4*j + m - 1] = to_t( ang, false, true );
+                scale[3*j + m] = FLT(1) / std::sqrt( h ? (FLT(1) - t*t) : (FLT(1) + t*t) );
+                if ( to_t( scale[3*j + m], false, true ) != _one_fxd ) scale_cnt = j + 1;
+            }
+            a[4*j + 2] = a[4*j + 0] >> 1;                               // |z| >= this picks digit 1
+            a[4*j + 3] = (a[4*j + 0] + a[4*j + 1]) >> 1;                // |z| >= this picks digit 2
+            if ( debug ) printf( "r4: h=%d j=%2d s=%2d a1=%30.27g a2=%30.27g scale1=%30.27g scale2=%30.27g\n", h, j, s, 
+                                 _to_flt(a[4*j], false, true), _to_flt(a[4*j+1], false, true), scale[3*j+1], scale[3*j+2] );
+        }
+
+        FLT gain = _to_flt( h ? _hyperbolic_rotation_gain_fxd : _circular_rotation_gain_fxd, false, true );
+        if ( h ) {
+            for( uint32_t i : { 1, 2, 3, 4, 4 } ) gain /= std::sqrt( FLT(1) - std::pow( FLT(4), -FLT(i) ) );
+        }
+        const uint32_t group_cnt = std::max( (scale_cnt + R4_SCALE_GROUP_N - 1) / R4_SCALE_GROUP_N, uint32_t(1) );
+        T * group_scale = new T[group_cnt * R4_SCALE_GROUP_SIZE];
+        for( uint32_t g = 0; g < group_cnt; g++ )
+        {
+            for( uint32_t i = 0; i < R4_SCALE_GROUP_SIZE; i++ )
+            {
+                FLT      prod = (g == 0) ? gain : FLT(1);
+                uint32_t ii   = i;
+                for( uint32_t k = 0; k < R4_SCALE_GROUP_N; k++, ii /= 3 )
+                {
+                    uint32_t j = g*R4_SCALE_GROUP_N + k;
+                    if ( j < scale_cnt ) prod *= scale[3*j + ii%3];
+                }
+                group_scale[g*R4_SCALE_GROUP_SIZE + i] = to_t( prod, false, true );
+            }
+        }
+        (h ? _hyperbolic_r4_scale_fxd : _circular_r4_scale_fxd) = group_scale;
+        delete[] scale;
+    }
+
+    _radix         = radix;
+    _shortcut_i    = shortcut_i;
+    _arith_backend = arith_backend;
+    _cr_level_cnt  = 0;
+    _cr_err_w      = 0;
+    _cr_fast       = false;
+    for( uint32_t k = 0; k < FN_KERNEL_CNT; k++ )
+    {
+        _fn_backend[k] = FN_BACKEND::CORDIC;
+        for( FN_APPROX& a : _fn_approx[k] ) a.coef = nullptr;
+    }
+
+    //-----------------------------------------------------
+    // sincos table: entry j is for the middle a of slice j of 0 .. PI/4,
+    // so the remaining angle is at most PI/2^(k+3) < sum of atan(2^-i) for i >= k+2.
+    //-----------------------------------------------------
+    _four_div_pi_fxd    = to_t( FLT(4) / M_PI, false, true );
+    _sincos_lut_w       = sincos_lut_w;
+    _sincos_lut_first_i = sincos_lut_w + 2;
+    _sincos_lut_fxd     = nullptr;
+    if ( sincos_lut_w != 0 ) {
+        const uint32_t cnt   = uint32_t(1) << sincos_lut_w;
+        const uint32_t end_i = (shortcut_i != 0) ? shortcut_i : n;
+        FLT gain = 1;
+        FLT reach = 0;
+        for( uint32_t i = _sincos_lut_first_i; i <= end_i; i++ )
+        {
+            FLT t = std::ldexp( FLT(1), -int(i) );
+            gain  *= std::sqrt( FLT(1) + t*t );
+            reach += std::atan( t );
+        }
+        cassert( reach > M_PI / FLT(cnt) / 8, "sincos table slices are too wide for the remaining iterations" );
+        _sincos_lut_fxd = new T[3*cnt];
+        for( uint32_t j = 0; j < cnt; j++ )
+        {
+            FLT a = (FLT(j) + FLT(0.5)) * M_PI / FLT(4*cnt);
+            _sincos_lut_fxd[3*j + 0] = to_t( std::cos( a ) / gain, false, true );
+            _sincos_lut_fxd[3*j + 1] = to_t( std::sin( a ) / gain, false, true );
+            _sincos_lut_fxd[3*j + 2] = to_t( a, false, true );
+        }
+    }
+
+    //-----------------------------------------------------
+    // 4/PI bits for reduce_sincos_arg_int(): bit j of 4/PI (weight 2^-j) is bit j+1 of 2/PI.
+    // The largest argument needs a 128-bit window starting at bit _exp_unbiased_max-fgw-2,
+    // plus one more word to shift it into place.
+    //-----------------------------------------------------
+    _four_div_pi_bits = nullptr;
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        const uint32_t j_max = std::max( int32_t(_exp_unbiased_max) - int32_t(_frac_guard_w) - 2, 0 );
+        const uint32_t cnt   = j_max/64 + 3;
+        if ( _is_float && 64*cnt <= 24*(sizeof( TWO_DIV_PI_24 ) / sizeof( TWO_DIV_PI_24[0] )) ) {
+            _four_div_pi_bits = new uint64_t[cnt];
+            for( uint32_t w = 0; w < cnt; w++ )
+            {
+                uint64_t bits = 0;
+                for( uint32_t j = 64*w; j < 64*(w+1); j++ )
+                {
+                    bits = (bits << 1) | ((TWO_DIV_PI_24[j/24] >> (23 - j%24)) & 1);
+                }
+                _four_div_pi_bits[w] = bits;
+            }
+        }
+    }
+
+    //-----------------------------------------------------
+    // exp and log tables: same idea, with the hyperbolic iteration schedule
+    // (4, 13, 40, ... repeated) starting at k+2.  The exp remaining angle is at most
+    // log(2)/2^(k+1) and the log one (atanh of (w-1)/(w+1)) at most about 2^-(k+2).
+    //-----------------------------------------------------
+    _one_div_log2_fxd    = to_t( FLT(1) / std::log( FLT(2) ), false, true );
+    _log2_fxd            = to_t( std::log( FLT(2) ), false, true );
+
+    //-----------------------------------------------------
+    // expc() and logc() constants for e and 10.  The first few other bases are converted
+    // on first use and kept in _base_other[]; after that, each call converts its own.
+    //-----------------------------------------------------
+    _base_other_cnt = 0;
+    for( BASE_CONSTS * c : { &_base_e, &_base_10 } )
+    {
+        c->b             = (c == &_base_e) ? FLT(M_E) : FLT(10);
+        c->log2_b        = to_t( std::log2( c->b ), false );
+        c->one_div_log_b = to_t( FLT(1) / std::log( c->b ), false );
+    }
+    _exp_log_lut_w       = exp_log_lut_w;
+    _exp_log_lut_first_i = exp_log_lut_w + 2;
+    _exp_lut_fxd         = nullptr;
+    _log_lut_fxd         = nullptr;
+    if ( exp_log_lut_w != 0 ) {
+        const uint32_t cnt   = uint32_t(1) << exp_log_lut_w;
+        const uint32_t end_i = (shortcut_i != 0) ? shortcut_i : n;
+        FLT gain = 1;
+        FLT reach = 0;
+        uint32_t next_dup_i = 4;
+        while( next_dup_i < _exp_log_lut_first_i ) next_dup_i = 3*next_dup_i + 1;
+        for( uint32_t i = _exp_log_lut_first_i; i <= end_i; i++ )
+        {
+            FLT t = std::ldexp( FLT(1), -int(i) );
+            gain  *= std::sqrt( FLT(1) - t*t );
+            reach += std::atanh( t );
+            if ( i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                i--;
+            }
+        }
+        cassert( reach > std::log( FLT(2) ) / FLT(2*cnt), "exp table slices are too wide for the remaining iterations" );
+        cassert( reach > FLT(1) / FLT(2*cnt),             "log table slices are too wide for the remaining iterations" );
+        _exp_lut_fxd = new T[2*cnt];
+        _log_lut_fxd = new T[2*cnt];
+        for( uint32_t j = 0; j < cnt; j++ )
+        {
+            FLT a = (FLT(j) + FLT(0.5)) * std::log( FLT(2) ) / FLT(cnt);
+            _exp_lut_fxd[2*j + 0] = to_t( std::exp( a ) / gain, false, true );
+            _exp_lut_fxd[2*j + 1] = to_t( a, false, true );
+
+            FLT c = FLT(1) + (FLT(j) + FLT(0.5)) / FLT(cnt);
+            _log_lut_fxd[2*j + 0] = to_t( FLT(1) / c, false, true );
+            _log_lut_fxd[2*j + 1] = to_t( std::log( c / FLT(2) ), false, true );
+        }
+    }
+
+    //-----------------------------------------------------
+    // cbrt() and rcbrt(): the seed is the minimax quadratic for m^(-1/3) on 1..2
+    // (relative error < 2^-9.1), and 2^(j/3) takes care of the exponent mod 3.
+    //-----------------------------------------------------
+    _third_fxd          = to_t( FLT(1) / FLT(3), false, true );
+    _cbrt_fxd[0]        = _one_fxd;
+    _cbrt_fxd[1]        = to_t( std::cbrt( FLT(2) ), false, true );
+    _cbrt_fxd[2]        = to_t( std::cbrt( FLT(4) ), false, true );
+    _rcbrt_seed_fxd[0]  = to_t( FLT( 1.3881568674137932  ), false, true );
+    _rcbrt_seed_fxd[1]  = to_t( FLT(-0.48332248088936014 ), false, true );
+    _rcbrt_seed_fxd[2]  = to_t( FLT( 0.09339791157026252 ), false, true );
+    _asin_series_fxd[0] = to_t( FLT(1)  / FLT(6),    false, true );
+    _asin_series_fxd[1] = to_t( FLT(3)  / FLT(40),   false, true );
+    _asin_series_fxd[2] = to_t( FLT(5)  / FLT(112),  false, true );
+    _asin_series_fxd[3] = to_t( FLT(35) / FLT(1152), false, true );
+    _asin_series_fxd[4] = to_t( FLT(63) / FLT(2816), false, true );
+    _asin_series_fxd[5] = to_t( FLT(231)/ FLT(13312),false, true );
+    _atanh_series_cnt = uint32_t( std::ceil( FLT(_frac_guard_w + 1) / std::log2( FLT(9) ) ) );
+    _atanh_series_fxd = new T[_atanh_series_cnt];
+    for( uint32_t j = 0; j < _atanh_series_cnt; j++ ) _atanh_series_fxd[j] = to_t( FLT(1) / FLT(2*j + 3), false, true );
+
+    //-----------------------------------------------------
+    // sinh() and tanh() of |x| < 1/2: v^2j/(2j)! with v^2 < 1/4 drops below the guard bits
+    // after _sinhcosh_series_cnt terms.
+    //-----------------------------------------------------
+    _sinhcosh_series_cnt = 1;
+    for( FLT t = 1; t >= std::ldexp( FLT(1), -int32_t(_frac_guard_w) - 1 ); _sinhcosh_series_cnt++ )
+    {
+        t /= FLT(4) * FLT(2*_sinhcosh_series_cnt - 1) * FLT(2*_sinhcosh_series_cnt);
+    }
+    _inv_fact_fxd = new T[2*_sinhcosh_series_cnt];
+    FLT inv_fact = 1;
+    for( uint32_t k = 0; k < 2*_sinhcosh_series_cnt; k++ )
+    {
+        if ( k != 0 ) inv_fact /= FLT(k);
+        _inv_fact_fxd[k] = to_t( inv_fact, false, true );
+    }
+
+    //-----------------------------------------------------
+    // mulc() plans: the mantissa of each constant recoded into canonical signed digits
+    // (no two adjacent digits are nonzero), so that x*c is a short list of shift/adds
+    // of x's mantissa.  The sums are done with up to 8 extra low bits and then rounded.
+    //-----------------------------------------------------
+    _mulc_headroom_w = std::max( 0, std::min( 8, int(sizeof(T)*8) - 4 - int(_frac_guard_w) ) );
+    _mulc_plan = new MULC_PLAN[MULC_CNT];
+    const std::pair<MULC, T> mulc_c[] = {
+        { MULC::hyperbolic_vectoring_one_over_gain, _hyperbolic_vectoring_one_over_gain },
+        { MULC::hyperbolic_rotation_one_over_gain,  _hyperbolic_rotation_one_over_gain },
+        { MULC::circular_vectoring_one_over_gain,   _circular_vectoring_one_over_gain },
+        { MULC::circular_rotation_one_over_gain,    _circular_rotation_one_over_gain },
+        { MULC::third,                              _third },
+        { MULC::neg_third,                          _neg_third },
+        { MULC::sqrt2_div_2,                        _sqrt2_div_2 },
+        { MULC::pi,                                 _pi },
+        { MULC::one_div_pi,                         _one_div_pi },
+        { MULC::two_div_pi,                         _two_div_pi },
+        { MULC::pi_div_2,                           _pi_div_2 },
+        { MULC::four_div_pi,                        _four_div_pi },
+        { MULC::pi_div_4,                           _pi_div_4 },
+        { MULC::log2,                               _log2 },
+        { MULC::log10,                              _log10 },
+        { MULC::one,                                _one },
+        { MULC::deg_per_pi,                         (is_float || FLT(180) < FLT(_maxint)) ? to_t( FLT(180) ) : _zero },
+        { MULC::pi_per_deg,                         to_t( FLT(1) / FLT(180) ) },
+        { MULC::one_div_log2,                       to_t( FLT(1) / std::log( FLT(2) ), false ) },
+        { MULC::e_log2_b,                           _base_e.log2_b },
+        { MULC::e_one_div_log_b,                    _base_e.one_div_log_b },
+        { MULC::ten_log2_b,                         _base_10.log2_b },
+        { MULC::ten_one_div_log_b,                  _base_10.one_div_log_b },
+    };
+    static_assert( sizeof( mulc_c ) / sizeof( mulc_c[0] ) == MULC_CNT, "every MULC needs a constant" );
+    for( const auto& kc : mulc_c ) mulc_plan_set( kc.first, kc.second );
+    _base_e.log2_b_plan         = &_mulc_plan[uint32_t(MULC::e_log2_b)];
+    _base_e.one_div_log_b_plan  = &_mulc_plan[uint32_t(MULC::e_one_div_log_b)];
+    _base_10.log2_b_plan        = &_mulc_plan[uint32_t(MULC::ten_log2_b)];
+    _base_10.one_div_log_b_plan = &_mulc_plan[uint32_t(MULC::ten_one_div_log_b)];
 }
 
-template< typename T, typename FLT >
-Cordic<T,FLT>::~Cordic( void )
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::mulc_plan_set( MULC k, const T& c )
+{
+    mulc_plan_build( _mulc_plan[uint32_t(k)], c );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::mulc_plan_build( MULC_PLAN& plan, const T& c ) const
+{
+    plan.c         = c;
+    plan.digit_cnt = 0;
+    T m = c;
+    EXP_CLASS m_exp_class;
+    deconstruct( m, m_exp_class, plan.c_exp, plan.c_sign );
+    if ( m_exp_class != EXP_CLASS::NORMAL ) return;                     // e.g., 180 doesn't fit in int_w bits; mul() it is
+    for( int32_t p = 0; m != 0; p++, m >>= 1 )
+    {
+        if ( (m & 1) == 0 ) continue;
+        bool is_neg = (m & 3) == 3;                                     // ...11 -> digit -1, carry into the next bit
+        plan.digit_shift[plan.digit_cnt] = int32_t(_frac_guard_w) - p;   // -1 for the carry out of the top bit
+        plan.digit_neg[plan.digit_cnt]   = is_neg;
+        plan.digit_cnt++;
+        m += is_neg ? T(1) : T(-1);
+    }
+    if ( debug ) std::cout << "mulc plan: c=" << _to_flt(plan.c) << " digits=" << plan.digit_cnt << "\n";
+}
+
+template< typename T, typename FLT, typename CORE >
+Cordic<T,FLT,CORE>::~Cordic( void )
 {
     if ( logger != nullptr ) logger->cordic_destructed( this );
 
     delete _circular_atan_fxd;
     delete _hyperbolic_atanh_fxd;
+    delete[] _circular_r4_fxd;
+    delete[] _circular_r4_scale_fxd;
+    delete[] _hyperbolic_r4_fxd;
+    delete[] _hyperbolic_r4_scale_fxd;
+    delete[] _sincos_lut_fxd;
+    delete[] _four_div_pi_bits;
+    delete[] _exp_lut_fxd;
+    delete[] _log_lut_fxd;
+    delete[] _mulc_plan;
+    delete[] _atanh_series_fxd;
+    delete[] _inv_fact_fxd;
+    for( uint32_t i = 0; i < _cr_level_cnt; i++ ) delete _cr_cordic[i];
+    for( uint32_t k = 0; k < FN_KERNEL_CNT; k++ )
+    {
+        for( FN_APPROX& a : _fn_approx[k] ) delete[] a.coef;
+    }
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::log_constructed( void )
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::log_constructed( void )
 {
     if ( logger != nullptr ) logger->cordic_constructed( this, _int_w|_exp_w, _frac_w, _is_float, _guard_w, _n );
 }
@@ -1161,231 +2121,278 @@ void Cordic<T,FLT>::log_constructed( void )
 //-----------------------------------------------------
 // Constants
 //-----------------------------------------------------
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::is_float( void ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::is_float( void ) const
 {
     return _is_float;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::int_w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::int_w( void ) const
 {
     return _int_w;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::exp_w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::exp_w( void ) const
 {
     return _exp_w;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::frac_w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::frac_w( void ) const
 {
     return _frac_w;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::guard_w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::guard_w( void ) const
 {
     return _guard_w;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::w( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::w( void ) const
 {
     return _w;
 }
 
-template< typename T, typename FLT >
-inline uint32_t Cordic<T,FLT>::n( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::n( void ) const
 {
     return _n;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::maxint( void ) const
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::radix( void ) const
+{
+    return _radix;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::shortcut_i( void ) const
+{
+    return _shortcut_i;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::iter_n( uint32_t n ) const
+{
+    return (_thread_prec_cordic == this) ? std::min( n, _thread_prec_bits + 4 ) : n;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::iter_shortcut_n( void ) const
+{
+    //-----------------------------------------------------
+    // After the shortcut at step s, the error is about 2^-(2s-1),
+    // so a Precision scope of b bits needs only s = (b+1)/2 + 1.
+    //-----------------------------------------------------
+    if ( _shortcut_i == 0 ) return iter_n( _n );
+    return (_thread_prec_cordic == this) ? std::min( _shortcut_i, (_thread_prec_bits + 4)/2 + 1 ) : _shortcut_i;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::sincos_lut_w( void ) const
+{
+    return _sincos_lut_w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline uint32_t Cordic<T,FLT,CORE>::exp_log_lut_w( void ) const
+{
+    return _exp_log_lut_w;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::BACKEND Cordic<T,FLT,CORE>::arith_backend( void ) const
+{
+    return _arith_backend;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::maxint( void ) const
 {
     return _maxint;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::max( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::max( void ) const
 {
     _log_1f( push_constant, to_flt(_max) );
     return _max;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::min( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::min( void ) const
 {
     _log_1f( push_constant, to_flt(_min) );
     return _min;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::denorm_min( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::denorm_min( void ) const
 {
     return min();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::lowest( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::lowest( void ) const
 {
     _log_1f( push_constant, to_flt(_lowest) );
     return _lowest;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::epsilon( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::epsilon( void ) const
 {
     return min();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::round_error( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::round_error( void ) const
 {
     return min();
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::zero( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::zero( void ) const
 {
     _log_1f( push_constant, to_flt(_zero) );
     return _zero;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::one( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::one( void ) const
 {
     _log_1f( push_constant, to_flt(_one) ); 
     return _one;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::neg_one( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::neg_one( void ) const
 {
     _log_1f( push_constant, to_flt(_neg_one) ); 
     return _neg_one;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::two( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::two( void ) const
 {
     _log_1f( push_constant, to_flt(_two) ); 
     return _two;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::half( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::half( void ) const
 {
     _log_1f( push_constant, to_flt(_half) ); 
     return _half;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::quarter( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::quarter( void ) const
 {
     _log_1f( push_constant, to_flt(_quarter) ); 
     return _quarter;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqrt2( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt2( void ) const
 {
     _log_1f( push_constant, to_flt(_sqrt2) ); 
     return _sqrt2;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqrt2_div_2( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt2_div_2( void ) const
 {
     _log_1f( push_constant, to_flt(_sqrt2_div_2) ); 
     return _sqrt2_div_2;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pi( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pi( void ) const
 {
     _log_1f( push_constant, to_flt(_pi) ); 
     return _pi;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::tau( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::tau( void ) const
 {
     _log_1f( push_constant, to_flt(_tau) ); 
     return _tau;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pi_div_2( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pi_div_2( void ) const
 {
     _log_1f( push_constant, to_flt(_pi_div_2) ); 
     return _pi_div_2;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pi_div_4( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pi_div_4( void ) const
 {
     _log_1f( push_constant, to_flt(_pi_div_4) ); 
     return _pi_div_4;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::one_div_pi( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::one_div_pi( void ) const
 {
     _log_1f( push_constant, to_flt(_one_div_pi) ); 
     return _one_div_pi;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::two_div_pi( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::two_div_pi( void ) const
 {
     _log_1f( push_constant, to_flt(_two_div_pi) ); 
     return _two_div_pi;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::four_div_pi( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::four_div_pi( void ) const
 {
     _log_1f( push_constant, to_flt(_four_div_pi) ); 
     return _four_div_pi;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::e( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::e( void ) const
 {
     _log_1f( push_constant, to_flt(_e) ); 
     return _e;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nan( const char * arg ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nan( const char * arg ) const
 {
     return to_t( FLT( std::strtod( arg, nullptr ) ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::quiet_NaN( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::quiet_NaN( void ) const
 {
     return to_t( std::numeric_limits<FLT>::quiet_NaN() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::signaling_NaN( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::signaling_NaN( void ) const
 {
     return to_t( std::numeric_limits<FLT>::signaling_NaN() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::infinity( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::infinity( void ) const
 {
     return to_t( std::numeric_limits<FLT>::infinity() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::ninfinity( void ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ninfinity( void ) const
 {
     return to_t( -std::numeric_limits<FLT>::infinity() );
 }
@@ -1393,8 +2400,8 @@ inline T Cordic<T,FLT>::ninfinity( void ) const
 //-----------------------------------------------------
 // Conversion
 //-----------------------------------------------------
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::to_t( FLT _x, bool is_final, bool to_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::to_t( FLT _x, bool is_final, bool to_fixed ) const
 {
     if ( is_final && debug ) std::cout << "to_t begin: x=" << _x << " is_final=" << is_final << " to_fixed=" << to_fixed << "\n";
     FLT x = _x;
@@ -1452,8 +2459,8 @@ inline T Cordic<T,FLT>::to_t( FLT _x, bool is_final, bool to_fixed ) const
                     x_exp_class = EXP_CLASS::NORMAL;
                     x_t |= _one_fxd;
                 } else if ( x_class == FP_SUBNORMAL ) {
-                    x_exp_class = EXP_CLASS::SUBNORMAL;
-                    x_exp = 0;
+                    x_exp_class = (x_t == 0) ? EXP_CLASS::ZERO : EXP_CLASS::SUBNORMAL;
+                    x_exp += 1;                                 // same exponent as smallest normal, but no implicit 1.
                 } else {
                     x_exp_class = EXP_CLASS::NOT_A_NUMBER;
                     x_exp = 0;
@@ -1482,7 +2489,7 @@ inline T Cordic<T,FLT>::to_t( FLT _x, bool is_final, bool to_fixed ) const
                  "to_t: integer part of |x| " + std::to_string(x) + " does not fit in fixed-point int_w bits" ); 
         
         FLT x_f = x * FLT( _one_fxd );  // treat it as an integer
-        switch( _rounding_mode )
+        switch( fegetround() )
         {
             case FE_NOROUND:                                                        break;
             case FE_DOWNWARD:                       x_f = std::floor( x_f );        break;
@@ -1499,14 +2506,14 @@ inline T Cordic<T,FLT>::to_t( FLT _x, bool is_final, bool to_fixed ) const
     return x_t;
 }
 
-template< typename T, typename FLT >
-inline FLT Cordic<T,FLT>::to_flt( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline FLT Cordic<T,FLT,CORE>::to_flt( const T& x ) const
 {
     return _to_flt( x, true, false, true );
 }
 
-template< typename T, typename FLT >
-inline FLT Cordic<T,FLT>::_to_flt( const T& _x, bool is_final, bool from_fixed, bool allow_debug ) const
+template< typename T, typename FLT, typename CORE >
+inline FLT Cordic<T,FLT,CORE>::_to_flt( const T& _x, bool is_final, bool from_fixed, bool allow_debug ) const
 {
     T    x = _x;
     bool x_sign;
@@ -1527,13 +2534,10 @@ inline FLT Cordic<T,FLT>::_to_flt( const T& _x, bool is_final, bool from_fixed,
                 break;
 
             case EXP_CLASS::NORMAL: 
+            case EXP_CLASS::SUBNORMAL:                                  // deconstruct() gave it the exponent of the smallest normal
                 x_f = std::scalbn( FLT( x ), x_exp - _frac_guard_w );
                 break;
 
-            case EXP_CLASS::SUBNORMAL:
-                x_f = std::scalbn( FLT( x ), -_exp_bias - _frac_guard_w );
-                break;
-
             case EXP_CLASS::INFINITE:
                 x_f = std::numeric_limits<FLT>::infinity();
                 break;
@@ -1555,15 +2559,15 @@ inline FLT Cordic<T,FLT>::_to_flt( const T& _x, bool is_final, bool from_fixed,
     return x_f;
 }
 
-template< typename T, typename FLT >
-inline std::string Cordic<T,FLT>::to_string( const T& x, bool from_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline std::string Cordic<T,FLT,CORE>::to_string( const T& x, bool from_fixed ) const
 {
     // floating-point representation
     return std::to_string( _to_flt( x, false, from_fixed ) );  
 }
 
-template< typename T, typename FLT >
-inline std::string Cordic<T,FLT>::to_rstring( const T& _x, bool from_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline std::string Cordic<T,FLT,CORE>::to_rstring( const T& _x, bool from_fixed ) const
 {
     // raw integer representation
     T x = _x;
@@ -1611,8 +2615,8 @@ inline std::string Cordic<T,FLT>::to_rstring( const T& _x, bool from_fixed ) con
     return s+i;
 }
 
-template< typename T, typename FLT >
-inline std::string Cordic<T,FLT>::to_bstring( const T& _x, bool from_fixed ) const
+template< typename T, typename FLT, typename CORE >
+inline std::string Cordic<T,FLT,CORE>::to_bstring( const T& _x, bool from_fixed ) const
 {
     (void)from_fixed;
     // binary representation
@@ -1628,8 +2632,8 @@ inline std::string Cordic<T,FLT>::to_bstring( const T& _x, bool from_fixed ) con
     return bs;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::make_fixed( bool sign, const T& i, const T& f ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::make_fixed( bool sign, const T& i, const T& f ) const
 {
     cassert( !_is_float, "make_fixed may be called only for is_float=false Cordics" );
     cassert( i >= 0 && i <= _maxint, "make_fixed integer part must be in range 0 .. _maxint" );
@@ -1640,8 +2644,8 @@ inline T Cordic<T,FLT>::make_fixed( bool sign, const T& i, const T& f ) const
            (T(f)    << 0);
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::make_float( bool sign, const T& e, const T& f ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::make_float( bool sign, const T& e, const T& f ) const
 {
     cassert( _is_float, "make_float may be called only for is_float=true Cordics" );
     cassert( e >= 0 && e <= _exp_mask, "make_float biased exponent part must be in range 0 .. _exp_mask, got " + std::to_string(e) );
@@ -1654,9 +2658,12 @@ inline T Cordic<T,FLT>::make_float( bool sign, const T& e, const T& f ) const
 
 //-----------------------------------------------------
 // The CORDIC Functions
+//
+// When CORE fixes the format (see StaticCordic.h), each one hands the iterations to CORE,
+// which has them unrolled, unless a Precision scope or the shortcut changes how many there are.
 //-----------------------------------------------------
-template< typename T, typename FLT >
-void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
     //-----------------------------------------------------
     // input ranges allowed:
@@ -1672,7 +2679,11 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
     cassert( y0 >= -ONE       && y0 <= ONE,       "circular_rotation y0 must be in the range -1 .. 1" );
     cassert( z0 >= -ANGLE_MAX && z0 <= ANGLE_MAX, "circular_rotation |z0| must be <= circular_angle_max (" +
                                                   to_string(ANGLE_MAX, true) + "), got z0=" + to_string(z0, true) );
-
+    if ( _radix == 4 ) {
+        rotation_radix4( false, x0, y0, z0, x, y, z );
+        return;
+    }
+
     //-----------------------------------------------------
     // d = (z >= 0) ? 1 : -1
     // xi = x - d*(y >> i)
@@ -1682,7 +2693,13 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    if constexpr ( CORE::is_static ) {
+        if ( _shortcut_i == 0 && iter_n( _n ) == CORE::n_c ) {
+            CORE::circular_rotation( x, y, z );
+            return;
+        }
+    }
+    uint32_t n = iter_shortcut_n();
     for( uint32_t i = 0; i <= n; i++ )
     {
         T xi;
@@ -1704,6 +2721,17 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
         z = zi;
     }
 
+    if ( _shortcut_i != 0 ) {
+        //-----------------------------------------------------
+        // |z| < 2^(-n) now, so sin(z)=z and cos(z)=1 to within the lsb;
+        // do the rest of the rotation with one multiply.
+        //-----------------------------------------------------
+        T xi = x - mul_fxd( y, z );
+        y    = y + mul_fxd( x, z );
+        x    = xi;
+        z    = 0;
+    }
+
     //-----------------------------------------------------
     // circular rotation mode results after step n:
     //      x = gain*(x0*cos(z0) - y0*sin(z0))          gain=1.64676...
@@ -1712,8 +2740,8 @@ void Cordic<T,FLT>::circular_rotation( const T& x0, const T& y0, const T& z0, T&
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
     //-----------------------------------------------------
     // input ranges allowed:
@@ -1743,7 +2771,13 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    if constexpr ( CORE::is_static ) {
+        if ( _shortcut_i == 0 && iter_n( _n ) == CORE::n_c ) {
+            CORE::circular_vectoring( x, y, z );
+            return;
+        }
+    }
+    uint32_t n = iter_shortcut_n();
     for( uint32_t i = 0; i <= n; i++ )
     {
         T xi;
@@ -1765,6 +2799,15 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
         z = zi;
     }
 
+    if ( _shortcut_i != 0 && x != 0 ) {
+        //-----------------------------------------------------
+        // |y/x| < 2^(-n) now, so atan(y/x)=y/x to within the lsb;
+        // do the rest with one divide.
+        //-----------------------------------------------------
+        z = z + div_fxd( y, x );
+        y = 0;
+    }
+
     //-----------------------------------------------------
     // circular vectoring mode results after step n:
     //      x = gain*sqrt(x0^2 + y0^2)                  gain=1.64676...
@@ -1773,8 +2816,8 @@ void Cordic<T,FLT>::circular_vectoring( const T& x0, const T& y0, const T& z0, T
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
 {
     //-----------------------------------------------------
     // input ranges allowed:
@@ -1795,7 +2838,13 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
     //-----------------------------------------------------
     x = x0;
     y = y0;
-    uint32_t n = _n;
+    if constexpr ( CORE::is_static ) {
+        if ( _shortcut_i == 0 && iter_n( _n ) == CORE::n_c ) {
+            CORE::circular_vectoring_xy( x, y );
+            return;
+        }
+    }
+    uint32_t n = iter_shortcut_n();
     for( uint32_t i = 0; i <= n; i++ )
     {
         T xi;
@@ -1813,6 +2862,10 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
         y = yi;
     }
 
+    if ( _shortcut_i != 0 ) {
+        y = 0;                          // x is already gain*sqrt(...) to within the lsb
+    }
+
     //-----------------------------------------------------
     // circular vectoring mode results after step n:
     //      x = gain*sqrt(x0^2 + y0^2)                  gain=1.64676...
@@ -1820,8 +2873,8 @@ void Cordic<T,FLT>::circular_vectoring_xy( const T& x0, const T& y0, T& x, T& y
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
     //-----------------------------------------------------
     // input ranges allowed:
@@ -1837,6 +2890,10 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
     cassert( y0 >= -TWO       && y0 <= TWO,       "hyperbolic_rotation y0 must be in the range -2 .. 2" );
     cassert( z0 >= -ANGLE_MAX && z0 <= ANGLE_MAX, "hyperbolic_rotation |z0| must be <= hyperbolic_angle_max (" + 
                                                   to_string(ANGLE_MAX, true) + "), got z0=" + to_string(z0, true) );
+    if ( _radix == 4 ) {
+        rotation_radix4( true, x0, y0, z0, x, y, z );
+        return;
+    }
 
     //-----------------------------------------------------
     // d = (z >= 0) ? 1 : -1
@@ -1847,7 +2904,13 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
+    if constexpr ( CORE::is_static ) {
+        if ( _shortcut_i == 0 && iter_n( _n ) == CORE::n_c ) {
+            CORE::hyperbolic_rotation( x, y, z );
+            return;
+        }
+    }
+    uint32_t n = iter_shortcut_n();
     uint32_t next_dup_i = 4;     
     for( uint32_t i = 1; i <= n; i++ )
     {
@@ -1876,6 +2939,17 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
         }
     }
 
+    if ( _shortcut_i != 0 ) {
+        //-----------------------------------------------------
+        // |z| < 2^(-n) now, so sinh(z)=z and cosh(z)=1 to within the lsb;
+        // do the rest of the rotation with one multiply.
+        //-----------------------------------------------------
+        T xi = x + mul_fxd( y, z );
+        y    = y + mul_fxd( x, z );
+        x    = xi;
+        z    = 0;
+    }
+
     //-----------------------------------------------------
     // hyperbolic rotation mode results after step n:
     //      x = gain*(x0*cosh(z0) + y0*sinh(z0))        gain=0.828159...
@@ -1884,186 +2958,1062 @@ void Cordic<T,FLT>::hyperbolic_rotation( const T& x0, const T& y0, const T& z0,
     //-----------------------------------------------------
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::rotation_radix4( bool is_hyperbolic, const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
 {
     //-----------------------------------------------------
-    // input ranges allowed:
-    //      -2  <= x0 <= 2
-    //      -2  <= y0 <= 2
-    //      -PI <= z0 <= PI
-    //      |atanh(y0/x0)| <= 1.1182...
-    //-----------------------------------------------------
-    const T TWO = _two_fxd;
-    const T PI  = _pi_fxd;
-    const T ANGLE_MAX = _hyperbolic_angle_max_fxd;
-    if ( debug ) printf( "hyperbolic_vectoring begin: xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f]\n",
-                         x0, y0, z0, _to_flt(x0, false, true), _to_flt(y0, false, true), _to_flt(z0, false, true) );
-    cassert( x0 >= -TWO && x0 <= TWO, "hyperbolic_vectoring x0 must be in the range -2 .. 2" );
-    cassert( y0 >= -TWO && y0 <= TWO, "hyperbolic_vectoring y0 must be in the range -2 .. 2" );
-    cassert( z0 >= -PI  && z0 <= PI , "hyperbolic_vectoring z0 must be in the range -PI .. PI" );
-    cassert( (ANGLE_MAX == 0 || std::abs( std::atanh( _to_flt(y0, false, true) / _to_flt(x0, false, true) ) ) <= _to_flt(ANGLE_MAX, false, true)),
-                                        "hyperbolic_vectoring |atanh(y0/x0)| must be <= hyperbolic_angle_max=" + 
-                                        std::to_string(_to_flt(ANGLE_MAX, false, true)) );
-
-    //-----------------------------------------------------
-    // d = (y < 0) ? 1 : -1
-    // xi = x - d*(y >> i)
-    // yi = y + d*(x >> i)
-    // zi = z - d*arctanh(2^(-i))
+    // Radix-4 circular or hyperbolic rotation.
+    //
+    // Step j with shift s picks the digit d in {-2,-1,0,1,2} whose angle is nearest z:
+    //
+    // xi = x -/+ d*(y >> s)                            (circular: -, hyperbolic: +)
+    // yi = y   + d*(x >> s)
+    // zi = z   - atan[h](d*2^(-s))
+    //
+    // and scales the vector by sqrt(1 +/- d^2*2^(-2s)).  At the end, x and y are multiplied
+    // by c, 1/that for all the steps times the radix-2 gain, so that the results are the same as 
+    // for radix 2.  c comes from one lookup per group of R4_SCALE_GROUP_N steps (see the constructor).
     //-----------------------------------------------------
     x = x0;
     y = y0;
     z = z0;
-    uint32_t n = _n;
-    uint32_t next_dup_i = 4;     
-    for( uint32_t i = 1; i <= n; i++ )
+    uint32_t first_s;
+    if ( is_hyperbolic ) {
+        for( uint32_t i : { 1, 2, 3, 4, 4 } )
+        {
+            T xi;
+            T yi;
+            T zi;
+            if ( z >= 0 ) {
+                xi = x + (y >> i);
+                yi = y + (x >> i);
+                zi = z - _hyperbolic_atanh_fxd[i];
+            } else {
+                xi = x - (y >> i);
+                yi = y - (x >> i);
+                zi = z + _hyperbolic_atanh_fxd[i];
+            }
+            x = xi;
+            y = yi;
+            z = zi;
+        }
+        first_s = 5;
+    } else {
+        first_s = 0;
+    }
+
+    // step j shifts by first_s + 2*j, so a Precision scope drops the steps past iter_n()
+    const uint32_t last_s    = iter_n( _n );
+    const uint32_t cnt       = std::min( is_hyperbolic ? _hyperbolic_r4_cnt : _circular_r4_cnt,
+                                         (last_s >= first_s) ? ((last_s - first_s)/2 + 1) : 0 );
+    const uint32_t scale_cnt = std::min( is_hyperbolic ? _hyperbolic_r4_scale_cnt : _circular_r4_scale_cnt, cnt );
+    const T *      a         = is_hyperbolic ? _hyperbolic_r4_fxd       : _circular_r4_fxd;
+    const T *      scale     = is_hyperbolic ? _hyperbolic_r4_scale_fxd : _circular_r4_scale_fxd;
+    uint32_t       mag[8*sizeof(T)];                                // |digit| of each step
+    if constexpr ( std::is_integral<T>::value ) {
+        //-----------------------------------------------------
+        // Branch-free, and in two passes: the digits depend only on z, so pick
+        // them all first; then x, y, and c don't wait on z at every step.
+        //
+        // sign[j] is 0 or -1, nz[j] is 0 for digit 0 and -1 otherwise.
+        //-----------------------------------------------------
+        T       xl = x;                                             // locals so the loops don't store through x, y, z
+        T       yl = y;
+        T       zl = z;
+        T       sign[8*sizeof(T)];
+        T       nz[8*sizeof(T)];
+        bool    is_2[8*sizeof(T)];
+        for( uint32_t j = 0; j < cnt; j++ )
+        {
+            //-----------------------------------------------------
+            // Compare z against +/- both thresholds at once rather than taking |z| first,
+            // and build the angle from masks rather than a table lookup indexed by the digit;
+            // this keeps the z dependency chain short.
+            //-----------------------------------------------------
+            const T* aj = a + 4*j;
+            const T  p1 = -T(zl >=  aj[2]);
+            const T  p2 = -T(zl >=  aj[3]);
+            const T  n1 = -T(zl <  -aj[2]);
+            const T  n2 = -T(zl <  -aj[3]);
+            const T  d21 = aj[1] - aj[0];
+            zl         -= ((aj[0] & p1) + (d21 & p2)) - ((aj[0] & n1) + (d21 & n2));
+            sign[j]     = n1;
+            nz[j]       = p1 | n1;
+            is_2[j]     = (p2 | n2) != 0;
+        }
+        for( uint32_t j = 0; j < cnt; j++ )
+        {
+            const uint32_t sh = first_s + 2*j + 1 - is_2[j];            // x << 1 first so that s=0 with digit 2 works
+            T xs = ((xl << 1) >> sh) & nz[j];
+            T ys = ((yl << 1) >> sh) & nz[j];
+            xs   = (xs ^ sign[j]) - sign[j];
+            ys   = (ys ^ sign[j]) - sign[j];
+            T xi = is_hyperbolic ? (xl + ys) : (xl - ys);
+            yl  += xs;
+            xl   = xi;
+            if ( debug ) printf( "rotation_radix4: is_hyperbolic=%d j=%2d s=%2d digit=%d xy=[%.30f,%.30f]\n", int(is_hyperbolic), j, first_s + 2*j,
+                                 int((nz[j] & 1) * (1 + is_2[j]) * (sign[j] ? -1 : 1)), _to_flt(xl, false, true), _to_flt(yl, false, true) );
+        }
+        x = xl;
+        y = yl;
+        z = zl;
+        for( uint32_t j = 0; j < scale_cnt; j++ ) mag[j] = uint32_t(nz[j] & 1) + is_2[j];
+    } else {
+        for( uint32_t j = 0; j < cnt; j++, a += 4 )
+        {
+            uint32_t s = first_s + 2*j;
+            if ( debug ) printf( "rotation_radix4: is_hyperbolic=%d j=%2d s=%2d xyz=[%.30f,%.30f,%.30f]\n", int(is_hyperbolic), j, s,
+                                 _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true) );
+            bool zn = z < 0;
+            T    az = zn ? -z : z;
+            mag[j]  = 0;
+            if ( az < a[2] ) continue;                                  // digit 0
+
+            bool is_2 = az >= a[3];
+            mag[j]    = 1 + is_2;
+            T xs = !is_2 ? (x >> s) : (s == 0) ? (x << 1) : (x >> (s-1));
+            T ys = !is_2 ? (y >> s) : (s == 0) ? (y << 1) : (y >> (s-1));
+            T as = a[is_2];
+            if ( zn ) {
+                xs = -xs;
+                ys = -ys;
+                as = -as;
+            }
+            T xi = is_hyperbolic ? (x + ys) : (x - ys);
+            y += xs;
+            x  = xi;
+            z -= as;
+        }
+    }
+    T c;
+    for( uint32_t g = 0; g == 0 || g*R4_SCALE_GROUP_N < scale_cnt; g++, scale += R4_SCALE_GROUP_SIZE )
+    {
+        uint32_t i = 0;
+        for( uint32_t k = R4_SCALE_GROUP_N; k-- > 0; )
+        {
+            uint32_t j = g*R4_SCALE_GROUP_N + k;
+            i = 3*i + ((j < scale_cnt) ? mag[j] : 0);
+        }
+        c = (g == 0) ? scale[i] : mul_fxd( c, scale[i] );
+    }
+    x = mul_fxd( x, c );
+    y = mul_fxd( y, c );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline int32_t Cordic<T,FLT,CORE>::clz( const T& x ) const
+{
+    //-----------------------------------------------------
+    // Only differences of clz() values are used, so the container width doesn't matter.
+    //-----------------------------------------------------
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        return (x == 0) ? int32_t(8*sizeof(T)) : (__builtin_clzll( uint64_t( x ) ) - int32_t(64 - 8*sizeof(T)));
+    } else {
+        return x.clz();
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul_fxd( const T& x, const T& y ) const
+{
+    //-----------------------------------------------------
+    // x*y for two fixed-point values with _frac_guard_w fraction bits.
+    //-----------------------------------------------------
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        __extension__ typedef __int128 T2;
+        T2 p = T2( x ) * T2( y );
+        p += T2( 1 ) << (_frac_guard_w - 1);
+        return T( p >> _frac_guard_w );
+    } else {
+        if ( y < 0 ) return -mul_fxd( x, -y );
+        T p = 0;
+        T yy = y;
+        for( int32_t i = -int32_t(_frac_guard_w); yy != 0; i++, yy >>= 1 )
+        {
+            if ( (yy & 1) == 0 ) continue;
+            p += (i < 0) ? (x >> -i) : (x << i);
+        }
+        return p;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div_fxd( const T& y, const T& x ) const
+{
+    //-----------------------------------------------------
+    // y/x for two fixed-point values with _frac_guard_w fraction bits.
+    // |y/x| must be < 2.
+    //-----------------------------------------------------
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        __extension__ typedef __int128 T2;
+        T2 n = T2( y ) << _frac_guard_w;
+        T2 d = T2( x );
+        n += ((n < 0) == (d < 0)) ? (d/2) : (-d/2);                     // round to nearest
+        return T( n / d );
+    } else {
+        if ( x < 0 ) return div_fxd( -y, -x );
+        if ( y < 0 ) return -div_fxd( -y, x );
+        T q = 0;
+        T r = y;
+        for( uint32_t i = 0; i <= _frac_guard_w; i++ )
+        {
+            q <<= 1;
+            if ( r >= x ) {
+                r -= x;
+                q += 1;
+            }
+            r <<= 1;
+        }
+        return q;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div_fxd_nr( const T& y, const T& x ) const
+{
+    //-----------------------------------------------------
+    // y/x for two fixed-point values with _frac_guard_w fraction bits, 1 <= x < 2, 0 <= y < 2.
+    //
+    // r0 = 24/17 - 8/17*x is within 1/17 of 1/x, and each r = r*(2 - x*r) doubles the
+    // number of good bits.  Then q = y*r, and one correction step q += r*(y - x*q) using
+    // the exact remainder gets q to within an lsb.
+    //-----------------------------------------------------
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        __extension__ typedef __int128 T2;
+        const uint32_t fw = _frac_guard_w;
+        const T2 ONE = T2( 1 ) << fw;
+        const T2 TWO = ONE << 1;
+        T2 r = ((T2( 24 ) << fw) - T2( 8 ) * T2( x )) / 17;
+        for( uint32_t good = 4; good < (fw + 2); good *= 2 )
+        {
+            T2 xr = (T2( x ) * r + (ONE >> 1)) >> fw;
+            r = (r * (TWO - xr) + (ONE >> 1)) >> fw;
+        }
+        T2 q   = (T2( y ) * r + (ONE >> 1)) >> fw;
+        T2 rem = (T2( y ) << fw) - T2( x ) * q;                        // exact, scaled by 2^fw
+        q += ((rem >> fw) * r + (ONE >> 1)) >> fw;
+        return T( q );
+    } else {
+        return div_fxd( y, x );
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ratio_fxd( const T& y, const T& x, int32_t& exp ) const
+{
+    //-----------------------------------------------------
+    // Normalize both to 1 .. 2 like div() does, so that the quotient is in 0.5 .. 2
+    // and the difference of the shifts is its exponent.
+    //-----------------------------------------------------
+    int32_t y_shift = clz( y ) - _one_fxd_clz;
+    int32_t x_shift = clz( x ) - _one_fxd_clz;
+    T yn = (y_shift >= 0) ? (y << y_shift) : (y >> -y_shift);
+    T xn = (x_shift >= 0) ? (x << x_shift) : (x >> -x_shift);
+    exp = x_shift - y_shift;
+    if ( _arith_backend == BACKEND::NATIVE ) return div_fxd_nr( yn, xn );
+
+    T xx, yy, q;
+    linear_vectoring( xn, yn, _zero_fxd, xx, yy, q );
+    return q;
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation_lut( const T& z0, T& x, T& y ) const
+{
+    //-----------------------------------------------------
+    // Same as circular_rotation( 1/gain, 0, z0, x, y, z ) for 0 <= z0 <= PI/4 (plus a little),
+    // but the top _sincos_lut_w bits of z0*4/PI pick the starting vector from the table
+    // and the loop starts at iteration _sincos_lut_first_i.
+    //-----------------------------------------------------
+    const uint32_t max_j = (uint32_t(1) << _sincos_lut_w) - 1;
+    uint32_t j = mul_fxd( z0, _four_div_pi_fxd ) >> (_frac_guard_w - _sincos_lut_w);
+    if ( j > max_j ) j = max_j;
+    const T * e = _sincos_lut_fxd + 3*j;
+    x = e[0];
+    y = e[1];
+    T z = z0 - e[2];
+    if ( debug ) printf( "circular_rotation_lut begin: z0=%.30f j=%d xyz=[%.30f,%.30f,%.30f]\n",
+                         _to_flt(z0, false, true), j, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true) );
+
+    uint32_t n = iter_shortcut_n();
+    for( uint32_t i = _sincos_lut_first_i; i <= n; i++ )
     {
         T xi;
         T yi;
         T zi;
-        if ( debug ) printf( "hyperbolic_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
-                             i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int((x < 0) != (y < 0)) );
-        if ( y < 0 ) {
-            xi = x + (y >> i);
+        if constexpr ( std::is_integral<T>::value ) {
+            // branch-free: the sign of z is unpredictable
+            const T d = -T(z < 0);                              // 0 or -1
+            xi = x - (((y >> i) ^ d) - d);
+            yi = y + (((x >> i) ^ d) - d);
+            zi = z - ((_circular_atan_fxd[i] ^ d) - d);
+        } else if ( z >= 0 ) {
+            xi = x - (y >> i);
             yi = y + (x >> i);
-            zi = z - _hyperbolic_atanh_fxd[i];
+            zi = z - _circular_atan_fxd[i];
         } else {
-            xi = x - (y >> i);
+            xi = x + (y >> i);
             yi = y - (x >> i);
-            zi = z + _hyperbolic_atanh_fxd[i];
+            zi = z + _circular_atan_fxd[i];
         }
         x = xi;
         y = yi;
         z = zi;
+    }
+
+    if ( _shortcut_i != 0 ) {
+        T xi = x - mul_fxd( y, z );
+        y    = y + mul_fxd( x, z );
+        x    = xi;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::exp_lut( const T& z0 ) const
+{
+    //-----------------------------------------------------
+    // Same as hyperbolic_rotation( 1/gain, 1/gain, z0, x, y, z ) for 0 <= z0 < log(2) (plus a little),
+    // but the top _exp_log_lut_w bits of z0/log(2) pick the starting value exp(a) from the table
+    // and the loop starts at iteration _exp_log_lut_first_i.  x and y start out equal, so they
+    // stay equal and only x is needed.
+    //-----------------------------------------------------
+    const uint32_t max_j = (uint32_t(1) << _exp_log_lut_w) - 1;
+    uint32_t j = mul_fxd( z0, _one_div_log2_fxd ) >> (_frac_guard_w - _exp_log_lut_w);
+    if ( j > max_j ) j = max_j;
+    const T * e = _exp_lut_fxd + 2*j;
+    T x = e[0];
+    T z = z0 - e[1];
+    if ( debug ) printf( "exp_lut begin: z0=%.30f j=%d xz=[%.30f,%.30f]\n",
+                         _to_flt(z0, false, true), j, _to_flt(x, false, true), _to_flt(z, false, true) );
+
+    uint32_t n = iter_shortcut_n();
+    uint32_t next_dup_i = 4;
+    while( next_dup_i < _exp_log_lut_first_i ) next_dup_i = 3*next_dup_i + 1;
+    for( uint32_t i = _exp_log_lut_first_i; i <= n; i++ )
+    {
+        if constexpr ( std::is_integral<T>::value ) {
+            const T d = -T(z < 0);                              // 0 or -1
+            x += ((x >> i) ^ d) - d;
+            z -= (_hyperbolic_atanh_fxd[i] ^ d) - d;
+        } else if ( z >= 0 ) {
+            x += x >> i;
+            z -= _hyperbolic_atanh_fxd[i];
+        } else {
+            x -= x >> i;
+            z += _hyperbolic_atanh_fxd[i];
+        }
 
         if ( i == next_dup_i ) {
-            // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
             next_dup_i = 3*i + 1;
             i--;
         }
     }
 
-    //-----------------------------------------------------
-    // hyperbolic vectoring mode results after step n:
-    //      x = gain*sqrt(x0^2 - y0^2)                  gain=0.828159...
-    //      y = 0
-    //      z = z0 + atanh( y0/x0 )
-    //-----------------------------------------------------
+    if ( _shortcut_i != 0 ) x += mul_fxd( x, z );
+    return x;
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::log_lut( const T& m ) const
 {
     //-----------------------------------------------------
-    // input ranges allowed:
-    //      -2  <= x0 <= 2
-    //      -2  <= y0 <= 2
-    //-----------------------------------------------------
-    const T TWO = _two_fxd;
-    const T PI  = _pi_fxd;
-    if ( debug ) printf( "hyperbolic_vectoring_xy begin: xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "] xy=[%.30f,%.30f]\n",
-                         x0, y0, _to_flt(x0, false, true), _to_flt(y0, false, true) );
-    cassert( x0 >= -TWO && x0 <= TWO, "hyperbolic_vectoring_xy x0 must be in the range -2 .. 2" );
-    cassert( y0 >= -TWO && y0 <= TWO, "hyperbolic_vectoring_xy y0 must be in the range -2 .. 2" );
-
-    //-----------------------------------------------------
-    // d = (y < 0) ? 1 : -1
-    // xi = x - d*(y >> i)
-    // yi = y + d*(x >> i)
+    // For 1 <= m < 2, the top _exp_log_lut_w bits of m-1 pick c and 1/c from the table.
+    // Then w=m/c is near 1 and log(m/2) = log(c/2) + 2*atanh((w-1)/(w+1)), where the atanh
+    // comes from hyperbolic vectoring of ((w+1)/2, (w-1)/2) starting at iteration _exp_log_lut_first_i.
     //-----------------------------------------------------
-    x = x0;
-    y = y0;
-    uint32_t n = _n;
-    uint32_t next_dup_i = 4;     
-    for( uint32_t i = 1; i <= n; i++ )
+    const uint32_t max_j = (uint32_t(1) << _exp_log_lut_w) - 1;
+    uint32_t j = (m - _one_fxd) >> (_frac_guard_w - _exp_log_lut_w);
+    if ( j > max_j ) j = max_j;
+    const T * e = _log_lut_fxd + 2*j;
+    const T w = mul_fxd( m, e[0] );
+    T x = (w + _one_fxd) >> 1;
+    T y = (w - _one_fxd) >> 1;
+    T z = 0;
+    if ( debug ) printf( "log_lut begin: m=%.30f j=%d w=%.30f\n", _to_flt(m, false, true), j, _to_flt(w, false, true) );
+
+    uint32_t n = iter_shortcut_n();
+    uint32_t next_dup_i = 4;
+    while( next_dup_i < _exp_log_lut_first_i ) next_dup_i = 3*next_dup_i + 1;
+    for( uint32_t i = _exp_log_lut_first_i; i <= n; i++ )
     {
         T xi;
         T yi;
-        if ( debug ) printf( "hyperbolic_vectoring_xy: i=%2d xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "] xy=[%.30f,%.30f] test=%d\n", 
-                             i, x, y, _to_flt(x, false, true), _to_flt(y, false, true), int(y < 0) );
-        if ( y < 0 ) {
+        T zi;
+        if constexpr ( std::is_integral<T>::value ) {
+            const T d = -T(y >= 0);                             // 0 or -1
+            xi = x + (((y >> i) ^ d) - d);
+            yi = y + (((x >> i) ^ d) - d);
+            zi = z - ((_hyperbolic_atanh_fxd[i] ^ d) - d);
+        } else if ( y < 0 ) {
             xi = x + (y >> i);
             yi = y + (x >> i);
+            zi = z - _hyperbolic_atanh_fxd[i];
         } else {
             xi = x - (y >> i);
             yi = y - (x >> i);
+            zi = z + _hyperbolic_atanh_fxd[i];
         }
         x = xi;
         y = yi;
+        z = zi;
 
         if ( i == next_dup_i ) {
-            // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
             next_dup_i = 3*i + 1;
             i--;
         }
     }
 
-    //-----------------------------------------------------
-    // hyperbolic vectoring mode results after step n:
-    //      x = gain*sqrt(x0^2 - y0^2)                  gain=0.828159...
-    //      y = 0
-    //-----------------------------------------------------
+    if ( _shortcut_i != 0 ) z += div_fxd( y, x );
+    return e[1] + (z << 1);
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log_fxd( const T& m ) const
 {
+    if ( _fn_backend[uint32_t(FN_KERNEL::LOG)] != FN_BACKEND::CORDIC ) return fn_approx_eval( _fn_approx[uint32_t(FN_KERNEL::LOG)][0], m );
+    if ( _exp_log_lut_w != 0 ) return log_lut( m );
+
     //-----------------------------------------------------
-    // input ranges allowed:
-    //      -2    <= x0 <= 2
-    //      -2    <= y0 <= 2
-    //      |z0|  <= 1
+    // log(m/2) = 2*atanh((m/2-1)/(m/2+1)), and hyperbolic vectoring of (m/2+1, m/2-1)
+    // gives the atanh directly, with no divide.
     //-----------------------------------------------------
-    const T ONE = _one_fxd;
-    const T TWO = _two_fxd;
-    if ( debug ) printf( "linear_rotation begin: xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f]\n",
-                         x0, y0, z0, _to_flt(x0, false, true), _to_flt(y0, false, true), _to_flt(z0, false, true) );
-    cassert( x0 >= -TWO && x0 <= TWO, "linear_rotation x0 must be in the range -2 .. 2" );
-    cassert( y0 >= -TWO && y0 <= TWO, "linear_rotation y0 must be in the range -2 .. 2" );
-    //cassert( z0 >= -ONE && z0 <= ONE, "linear_rotation z0 must be in the range -1 .. 1" );
-    
+    T h = (m >> 1) | (m & 1);
+    T xx, yy, lg2;
+    hyperbolic_vectoring( h + _one_fxd, h - _one_fxd, _zero_fxd, xx, yy, lg2 );
+    return lg2 << 1;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp_fxd( const T& a ) const
+{
+    if ( _fn_backend[uint32_t(FN_KERNEL::EXP)] != FN_BACKEND::CORDIC ) return fn_approx_eval( _fn_approx[uint32_t(FN_KERNEL::EXP)][0], a );
+    if ( _exp_log_lut_w != 0 ) return exp_lut( a );
+
+    T x, y, z;
+    hyperbolic_rotation( _hyperbolic_rotation_one_over_gain_fxd, _hyperbolic_rotation_one_over_gain_fxd, a, x, y, z );
+    return x;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sincos_fxd( const T& a, T& co, T& si ) const
+{
+    if ( _fn_backend[uint32_t(FN_KERNEL::SINCOS)] != FN_BACKEND::CORDIC ) {
+        co = fn_approx_eval( _fn_approx[uint32_t(FN_KERNEL::SINCOS)][0], a );
+        si = fn_approx_eval( _fn_approx[uint32_t(FN_KERNEL::SINCOS)][1], a );
+    } else if ( _sincos_lut_w != 0 ) {
+        circular_rotation_lut( a, co, si );
+    } else {
+        T z;
+        circular_rotation( _circular_rotation_one_over_gain_fxd, _zero, a, co, si, z );
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+template< typename F >
+void Cordic<T,FLT,CORE>::fn_approx_build( FN_APPROX& a, F f, FLT lo, FLT hi, uint32_t piece_w )
+{
     //-----------------------------------------------------
-    // d = (z >= 0) ? 1 : -1
-    // xi = x 
-    // yi = y + d*(x >> i)
-    // zi = z - d*2^(-i)
+    // The pieces are 2^e wide so that finding x's piece is one shift.  Each piece gets the
+    // Chebyshev series of f through M Chebyshev nodes, which is cut off at the lowest degree
+    // whose dropped coefficients add up to less than tol in every piece.
+    //
+    // M is at least twice the degree any of the kernels needs, so the top half of the series
+    // is FLT rounding noise.  Coefficients below twice that noise are dropped without counting
+    // them, or a wide format would sum dozens of them and keep nearly all M terms.
     //-----------------------------------------------------
-    x = x0;
-    y = y0;
-    z = z0;
-    uint32_t n = _n;
-    T pow2 = ONE;
-    for( uint32_t i = 0; i <= n; i++, pow2 >>= 1 )
+    const uint32_t M     = (piece_w == 0) ? 64 : 16;
+    const int32_t  e     = int32_t( std::ceil( std::log2( hi - lo ) ) ) - int32_t(piece_w);
+    const FLT      width = std::ldexp( FLT(1), e );
+    const FLT      tol   = std::max( std::ldexp( FLT(1), -int32_t(_frac_guard_w) - 2 ), 8 * std::numeric_limits<FLT>::epsilon() );
+    cassert( e <= 0 && (int32_t(_frac_guard_w) + e) >= 1, "fn_approx_build: range must be at most 1 wide and pieces at least 2 lsbs wide" );
+
+    a.lo          = to_t( lo, false, true );
+    a.piece_shift = _frac_guard_w + e;
+    a.piece_cnt   = std::max( uint32_t( std::ceil( (hi - lo) / width ) ), uint32_t(1) );
+    a.u_shift     = 1 - e;
+    a.deg         = 0;
+    FLT * c = new FLT[a.piece_cnt * M];
+    for( uint32_t j = 0; j < a.piece_cnt; j++ )
     {
-        if ( debug ) printf( "linear_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
-                             i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(z >= 0) );
-        T yi;
-        T zi;
-        if ( z >= 0 ) {
-            yi = y + (x >> i);
-            zi = z - pow2;
-        } else {
-            yi = y - (x >> i);
-            zi = z + pow2;
+        FLT * cj = c + j*M;
+        const FLT mid = lo + (FLT(j) + FLT(0.5)) * width;
+        for( uint32_t k = 0; k < M; k++ ) cj[k] = 0;
+        for( uint32_t i = 0; i < M; i++ )
+        {
+            const FLT th = FLT(M_PI) * (FLT(i) + FLT(0.5)) / FLT(M);
+            const FLT fi = f( mid + width / FLT(2) * std::cos( th ) );
+            for( uint32_t k = 0; k < M; k++ ) cj[k] += fi * std::cos( FLT(k) * th );
         }
-        y = yi;
-        z = zi;
+        for( uint32_t k = 0; k < M; k++ ) cj[k] *= FLT(2) / FLT(M);
+        cj[0] /= FLT(2);
+
+        FLT noise = 0;
+        for( uint32_t k = M/2; k < M; k++ ) noise = std::max( noise, 2 * std::abs( cj[k] ) );
+        uint32_t deg = M - 1;
+        FLT dropped = 0;
+        for( ; deg > 0; deg-- )
+        {
+            const FLT ck = std::abs( cj[deg] );
+            if ( ck <= noise ) continue;
+            if ( (dropped + ck) >= tol ) break;
+            dropped += ck;
+        }
+        a.deg = std::max( a.deg, deg );
     }
 
-    //-----------------------------------------------------
-    // linear rotation mode results after step n:
-    //      x = x0
-    //      y = y0 + x0*z0
-    //      z = 0
-    //-----------------------------------------------------
+    delete[] a.coef;
+    a.coef = new T[a.piece_cnt * (a.deg+1)];
+    for( uint32_t j = 0; j < a.piece_cnt; j++ )
+    {
+        for( uint32_t k = 0; k <= a.deg; k++ ) a.coef[j*(a.deg+1) + k] = to_t( c[j*M + k], false, true );
+    }
+    delete[] c;
+    if ( debug ) printf( "fn_approx_build: lo=%.30f hi=%.30f pieces=%d deg=%d\n", double(lo), double(hi), a.piece_cnt, a.deg );
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::linear_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fn_approx_eval( const FN_APPROX& a, const T& x ) const
 {
     //-----------------------------------------------------
-    // input ranges allowed:
+    // Find x's piece, map x to u in -1 .. 1 across it, and sum the piece's
+    // series with Clenshaw's recurrence, which keeps the partial sums small.
+    //-----------------------------------------------------
+    const T d = x - a.lo;
+    uint32_t j = (d <= 0) ? 0 : uint32_t( d >> a.piece_shift );
+    if ( j >= a.piece_cnt ) j = a.piece_cnt - 1;
+    const T   u  = ((d - (T(j) << a.piece_shift)) << a.u_shift) - _one_fxd;
+    const T   u2 = u << 1;
+    const T * c  = a.coef + j*(a.deg+1);
+    T b1 = 0;
+    T b2 = 0;
+    for( uint32_t k = a.deg; k > 0; k-- )
+    {
+        T b0 = c[k] + mul_fxd( u2, b1 ) - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+    return c[0] + mul_fxd( u, b1 ) - b2;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rcbrt_fxd( const T& m ) const
+{
+    //-----------------------------------------------------
+    // m^(-1/3) for 1 <= m < 2.
+    //
+    // The seed comes from the backend.  CORDIC: m^(-1/3) = 2^(-1/3) * exp(-log(m/2)/3), where
+    // log_fxd() gives log(m/2) by hyperbolic vectoring and 0 <= -log(m/2)/3 < log(2)/3 is in
+    // exp_fxd()'s range.  NATIVE: the minimax quadratic, good to 9 bits.
+    //
+    // Then u = u + u*(1 - m*u^3)/3 needs no divide, and if u = m^(-1/3)*(1+e) then the
+    // new u = m^(-1/3)*(1 - 2e^2 + ...), so each step gets 2*good-1 bits.  The CORDIC seed
+    // is only a few bits short of the guard bits, so one step cleans up its rounding.
+    //-----------------------------------------------------
+    T u;
+    uint32_t good;
+    if ( _arith_backend == BACKEND::NATIVE ) {
+        u    = _rcbrt_seed_fxd[0] + mul_fxd( m, _rcbrt_seed_fxd[1] + mul_fxd( m, _rcbrt_seed_fxd[2] ) );
+        good = 9;
+    } else {
+        u    = mul_fxd( exp_fxd( mul_fxd( -log_fxd( m ), _third_fxd ) ), _cbrt_fxd[2] ) >> 1;
+        good = _frac_guard_w/2 + 2;
+    }
+    for( ; good < (_frac_guard_w + 2); good = 2*good - 1 )
+    {
+        T t = mul_fxd( mul_fxd( m, mul_fxd( u, u ) ), u );
+        u += mul_fxd( u, mul_fxd( _one_fxd - t, _third_fxd ) );
+    }
+    if ( debug ) printf( "rcbrt_fxd: m=%.30f u=%.30f\n", _to_flt(m, false, true), _to_flt(u, false, true) );
+    return u;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt_fxd( const T& u, int32_t& e ) const
+{
+    //-----------------------------------------------------
+    // Same as sqrt(), but u stays in fixed-point: normalize u to s*2^e with e even
+    // and 1/4 <= s < 1, then hyperbolic vectoring of (s+1, s-1) gives gain*2*sqrt(s).
+    //-----------------------------------------------------
+    int32_t shift = clz( u ) - _one_fxd_clz;
+    T s = (shift >= 0) ? (u << shift) : (u >> -shift);
+    e = -shift;
+    int32_t s_shift = (e & 1) ? 1 : 2;
+    s = (s >> s_shift) | T((s & ((T(1) << s_shift) - 1)) != 0);          // record sticky bit
+    e = (e + s_shift) / 2 - 1;
+
+    T xx, yy;
+    hyperbolic_vectoring_xy( s + _one_fxd, s - _one_fxd, xx, yy );
+    return mul_fxd( xx, _hyperbolic_vectoring_one_over_gain_fxd );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pown_fxd( const T& m, int64_t n, int64_t& e ) const
+{
+    //-----------------------------------------------------
+    // Square-and-multiply, renormalizing to 1 .. 2 after each product and counting
+    // the exponent in e.  Each rounding error gets raised to at most the n-th power,
+    // i.e., the relative error grows like |n| * 2^-fw, so fw needs log2|n| bits more
+    // than fgw.  With int64_t T, the products are kept with 62 fraction bits when that
+    // is enough, else with 124 fraction bits from four 64x64 multiplies, which covers
+    // any int n.  For n < 0, 1/m^|n| = (2/m^|n|) * 2^-1 is done with 62 bits.
+    //
+    // Other T have no wider type, so they keep fgw bits, and the error is
+    // about |n| * 2^-fgw, which stays below 1/2 ulp only while log2|n| < guard_w-1.
+    //-----------------------------------------------------
+    e = 0;
+    const uint64_t nn_start = (n < 0) ? uint64_t(-n) : uint64_t(n);
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        __extension__ typedef unsigned __int128 U2;
+        const uint32_t FW   = 62;
+        const uint64_t ONE  = uint64_t(1) << FW;
+        const uint64_t TWO  = ONE << 1;
+        uint32_t n_w = 0;
+        while( (nn_start >> n_w) != 0 ) n_w++;                         // |n| < 2^n_w
+        auto mul62 = [&]( uint64_t a, uint64_t b, int64_t& a_e, int64_t b_e ) -> uint64_t
+        {
+            uint64_t p = uint64_t( (U2( a ) * b + (U2( 1 ) << (FW-1))) >> FW );
+            a_e += b_e;
+            if ( p >= TWO ) {
+                p = (p >> 1) + (p & 1);
+                a_e++;
+            }
+            return p;
+        };
+        uint64_t r;
+        if ( (_frac_guard_w + n_w + 2) <= FW ) {
+            uint64_t b   = uint64_t( m ) << (FW - _frac_guard_w);
+            int64_t  b_e = 0;
+            r = ONE;
+            for( uint64_t nn = nn_start; nn != 0; nn >>= 1 )
+            {
+                if ( nn & 1 ) r = mul62( r, b, e, b_e );
+                if ( nn > 1 ) b = mul62( b, b, b_e, b_e );
+            }
+        } else {
+            const uint32_t WFW  = 124;
+            const U2       WTWO = U2(1) << (WFW + 1);
+            const U2       LO   = ~uint64_t(0);
+            auto mul124 = [&]( U2 a, U2 b, int64_t& a_e, int64_t b_e ) -> U2
+            {
+                U2 ll  = (a & LO) * (b & LO);
+                U2 lh  = (a & LO) * (b >> 64);
+                U2 hl  = (a >> 64) * (b & LO);
+                U2 mid = (ll >> 64) + (lh & LO) + (hl & LO);             // bits 64 .. 129 of a*b
+                U2 hi  = (a >> 64) * (b >> 64) + (lh >> 64) + (hl >> 64) + (mid >> 64);
+                U2 p   = (hi << (128 - WFW)) + ((mid & LO) >> (WFW - 64)) + (((mid & LO) >> (WFW - 65)) & 1);
+                a_e += b_e;
+                if ( p >= WTWO ) {
+                    p = (p >> 1) + (p & 1);
+                    a_e++;
+                }
+                return p;
+            };
+            U2      b   = U2( m ) << (WFW - _frac_guard_w);
+            int64_t b_e = 0;
+            U2      rw  = U2(1) << WFW;
+            for( uint64_t nn = nn_start; nn != 0; nn >>= 1 )
+            {
+                if ( nn & 1 ) rw = mul124( rw, b, e, b_e );
+                if ( nn > 1 ) b  = mul124( b, b, b_e, b_e );
+            }
+            r = uint64_t( (rw + (U2(1) << (WFW - FW - 1))) >> (WFW - FW) );
+            if ( r >= TWO ) {
+                r >>= 1;
+                e++;
+            }
+        }
+        if ( n < 0 ) {
+            e = -e;
+            if ( r != ONE ) {
+                r = uint64_t( ((U2( 1 ) << (2*FW + 1)) + (r >> 1)) / r );
+                e--;
+            }
+        }
+        return T( (r + (uint64_t(1) << (FW - _frac_guard_w - 1))) >> (FW - _frac_guard_w) );
+    } else {
+        T       b   = m;
+        int64_t b_e = 0;
+        T       r   = _one_fxd;
+        for( uint64_t nn = nn_start; nn != 0; nn >>= 1 )
+        {
+            if ( nn & 1 ) {
+                r = mul_fxd( r, b );
+                e += b_e;
+                if ( r >= _two_fxd ) {
+                    r >>= 1;
+                    e++;
+                }
+            }
+            if ( nn > 1 ) {
+                b = mul_fxd( b, b );
+                b_e *= 2;
+                if ( b >= _two_fxd ) {
+                    b >>= 1;
+                    b_e++;
+                }
+            }
+        }
+        if ( n < 0 ) {
+            e = -e;
+            if ( r != _one_fxd ) {
+                r = div_fxd( _one_fxd, r ) << 1;
+                e--;
+            }
+        }
+        return r;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::asin_fxd( const T& t0 ) const
+{
+    //-----------------------------------------------------
+    // Double-rotation arcsine: rotate (1, 0) twice by the same +/-atan(2^-i) at each step,
+    // steering y toward t.  Each double rotation grows the vector by 1+2^-2i, so t grows
+    // by the same amount to keep up, and there is no gain to undo.  The double rotation is
+    //     x = x - d*2*2^-i*y - 2^-2i*x
+    //     y = y + d*2*2^-i*x - 2^-2i*y
+    // and z collects atan(2^-i) once, so it is doubled at the end.
+    // Each step is worth twice the usual angle, so run to the guard bits rather than _n
+    // and use atan(2^-i) = 2^-i past the end of the table.
+    // The steps get the comparison wrong near t == 1, which is why t is at most 1/2 here.
+    //-----------------------------------------------------
+    T x = _one_fxd;
+    T y = 0;
+    T z = 0;
+    T t = t0;
+    const uint32_t n = iter_n( std::max( _n, _frac_guard_w + 1 ) );
+    for( uint32_t i = 1; i <= n; i++ )
+    {
+        const T    a   = (i <= _n) ? _circular_atan_fxd[i] : (_one_fxd >> i);
+        const bool big = 2*i <= (_frac_guard_w + 1);
+        const T    x2  = big ? (x >> (2*i)) : T(0);
+        const T    y2  = big ? (y >> (2*i)) : T(0);
+        T xi;
+        T yi;
+        T zi;
+        if constexpr ( std::is_integral<T>::value ) {
+            const T d = -T((y > t) == (x >= 0));                // 0 or -1
+            xi = x - x2 - ((((y >> (i-1))) ^ d) - d);
+            yi = y - y2 + ((((x >> (i-1))) ^ d) - d);
+            zi = z + ((a ^ d) - d);
+        } else if ( (y <= t) == (x >= 0) ) {
+            xi = x - x2 - (y >> (i-1));
+            yi = y - y2 + (x >> (i-1));
+            zi = z + a;
+        } else {
+            xi = x - x2 + (y >> (i-1));
+            yi = y - y2 - (x >> (i-1));
+            zi = z - a;
+        }
+        x = xi;
+        y = yi;
+        z = zi;
+        if ( big ) t += t >> (2*i);
+    }
+    if ( debug ) printf( "asin_fxd: t=%.30f asin=%.30f\n", _to_flt(t0, false, true), _to_flt(z << 1, false, true) );
+    return z << 1;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::asin_fxd( const T& m, int32_t& e ) const
+{
+    //-----------------------------------------------------
+    // The double rotations leave z with an absolute error, which is a lot of ulps when
+    // asin(v) is small.  Below 2^-k, six terms of asin(v)/v = 1 + v^2/6 + 3v^4/40 + ...
+    // are exact to the guard bits, and multiplying that by m keeps v's own exponent.
+    //-----------------------------------------------------
+    const int32_t k = (int32_t(_frac_guard_w) + 13) / 14;
+    if ( e < -k ) {
+        T v2 = mul_fxd( m, m );
+        v2 = (-2*e <= int32_t(_frac_guard_w)) ? (v2 >> -2*e) : T(0);
+        T s = _asin_series_fxd[5];
+        for( int32_t j = 4; j >= 0; j-- ) s = _asin_series_fxd[j] + mul_fxd( s, v2 );
+        return mul_fxd( m, _one_fxd + mul_fxd( s, v2 ) );
+    } else {
+        T t = (e >= 0) ? (m << e) : (m >> std::min( -e, int32_t(_frac_guard_w) + 1 ));
+        e = 0;
+        return asin_fxd( t );
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atanh_fxd( const T& m, int32_t e ) const
+{
+    //-----------------------------------------------------
+    // atanh(v)/v = 1 + v^2/3 + v^4/5 + ... for v = m*2^e.  Each term is another v^2 down,
+    // so 2^e picks how many terms reach the guard bits, up to all of them for v near 1/3.
+    // Multiplying the sum by m keeps v's own exponent, like asin_fxd().
+    //-----------------------------------------------------
+    const int32_t fg = _frac_guard_w;
+    T v2 = mul_fxd( m, m );
+    v2 = (-2*e <= fg) ? (v2 >> -2*e) : T(0);
+    int32_t cnt = (e <= -3) ? ((fg - 2*e - 3) / (-2*e - 2)) : int32_t(_atanh_series_cnt);
+    if ( cnt > int32_t(_atanh_series_cnt) ) cnt = _atanh_series_cnt;
+    T s = 0;
+    for( int32_t j = cnt-1; j >= 0; j-- ) s = _atanh_series_fxd[j] + mul_fxd( s, v2 );
+    return mul_fxd( m, _one_fxd + mul_fxd( s, v2 ) );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinhcosh_series_fxd( const T& m, int32_t e, T& sih, T& coh ) const
+{
+    //-----------------------------------------------------
+    // sinh(v)/v = 1 + v^2/3! + v^4/5! + ...  and  cosh(v) = 1 + v^2/2! + v^4/4! + ...
+    // The rotation leaves sinh(v) with an absolute error, which is a lot of ulps for small v,
+    // so like asin_fxd(), multiply the series by m to keep v's own exponent.
+    //-----------------------------------------------------
+    T v2 = mul_fxd( m, m );
+    v2 = (-2*e <= int32_t(_frac_guard_w)) ? (v2 >> -2*e) : T(0);
+    T s = 0;
+    T c = 0;
+    for( uint32_t j = _sinhcosh_series_cnt-1; j > 0; j-- )
+    {
+        s = _inv_fact_fxd[2*j+1] + mul_fxd( s, v2 );
+        c = _inv_fact_fxd[2*j]   + mul_fxd( c, v2 );
+    }
+    sih = mul_fxd( m, _one_fxd + mul_fxd( s, v2 ) );
+    coh = _one_fxd + mul_fxd( c, v2 );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinhcosh_fxd( const T& x_orig, T x, int32_t x_exp, const T& r, T& e_pos, T& e_neg, int32_t& i ) const
+{
+    //-----------------------------------------------------
+    // x is the deconstructed mantissa of x_orig, and 1 <= r < 2.
+    // For |x| < 1, i=0 and f=|x|.  Otherwise, reduce_exp_arg() gives i and f.
+    // One hyperbolic_rotation() of (r/(2*gain), 0, f) gives r*cosh(f)/2 and r*sinh(f)/2,
+    // and their sum and difference are r*exp(f)/2 and r*exp(-f)/2.
+    //-----------------------------------------------------
+    i = 0;
+    if ( x_exp < 0 ) {
+        x >>= std::min( -x_exp, int32_t(_frac_guard_w) + 1 );
+    } else {
+        EXP_CLASS f_exp_class;
+        bool      f_sign;
+        x = abs( x_orig );
+        reduce_exp_arg( M_E, x, i, f_exp_class, f_sign );
+        if ( f_exp_class == EXP_CLASS::ZERO ) x = 0;
+    }
+
+    T xx, yy, zz;
+    hyperbolic_rotation( mul_fxd( _hyperbolic_rotation_one_over_gain_fxd, r >> 1 ), _zero_fxd, x, xx, yy, zz );
+    e_pos = xx + yy;
+    e_neg = xx - yy;
+    if ( i != 0 ) e_neg >>= std::min( 2*i, int32_t(_frac_guard_w) + 1 );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    //-----------------------------------------------------
+    // input ranges allowed:
+    //      -2  <= x0 <= 2
+    //      -2  <= y0 <= 2
+    //      -PI <= z0 <= PI
+    //      |atanh(y0/x0)| <= 1.1182...
+    //-----------------------------------------------------
+    const T TWO = _two_fxd;
+    const T PI  = _pi_fxd;
+    const T ANGLE_MAX = _hyperbolic_angle_max_fxd;
+    if ( debug ) printf( "hyperbolic_vectoring begin: xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f]\n",
+                         x0, y0, z0, _to_flt(x0, false, true), _to_flt(y0, false, true), _to_flt(z0, false, true) );
+    cassert( x0 >= -TWO && x0 <= TWO, "hyperbolic_vectoring x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -TWO && y0 <= TWO, "hyperbolic_vectoring y0 must be in the range -2 .. 2" );
+    cassert( z0 >= -PI  && z0 <= PI , "hyperbolic_vectoring z0 must be in the range -PI .. PI" );
+    cassert( (ANGLE_MAX == 0 || std::abs( std::atanh( _to_flt(y0, false, true) / _to_flt(x0, false, true) ) ) <= _to_flt(ANGLE_MAX, false, true)),
+                                        "hyperbolic_vectoring |atanh(y0/x0)| must be <= hyperbolic_angle_max=" + 
+                                        std::to_string(_to_flt(ANGLE_MAX, false, true)) );
+
+    //-----------------------------------------------------
+    // d = (y < 0) ? 1 : -1
+    // xi = x - d*(y >> i)
+    // yi = y + d*(x >> i)
+    // zi = z - d*arctanh(2^(-i))
+    //-----------------------------------------------------
+    x = x0;
+    y = y0;
+    z = z0;
+    if constexpr ( CORE::is_static ) {
+        if ( _shortcut_i == 0 && iter_n( _n ) == CORE::n_c ) {
+            CORE::hyperbolic_vectoring( x, y, z );
+            return;
+        }
+    }
+    uint32_t n = iter_shortcut_n();
+    uint32_t next_dup_i = 4;     
+    for( uint32_t i = 1; i <= n; i++ )
+    {
+        T xi;
+        T yi;
+        T zi;
+        if ( debug ) printf( "hyperbolic_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
+                             i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int((x < 0) != (y < 0)) );
+        if ( y < 0 ) {
+            xi = x + (y >> i);
+            yi = y + (x >> i);
+            zi = z - _hyperbolic_atanh_fxd[i];
+        } else {
+            xi = x - (y >> i);
+            yi = y - (x >> i);
+            zi = z + _hyperbolic_atanh_fxd[i];
+        }
+        x = xi;
+        y = yi;
+        z = zi;
+
+        if ( i == next_dup_i ) {
+            // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
+            next_dup_i = 3*i + 1;
+            i--;
+        }
+    }
+
+    if ( _shortcut_i != 0 && x != 0 ) {
+        //-----------------------------------------------------
+        // |y/x| < 2^(-n) now, so atanh(y/x)=y/x to within the lsb;
+        // do the rest with one divide.
+        //-----------------------------------------------------
+        z = z + div_fxd( y, x );
+        y = 0;
+    }
+
+    //-----------------------------------------------------
+    // hyperbolic vectoring mode results after step n:
+    //      x = gain*sqrt(x0^2 - y0^2)                  gain=0.828159...
+    //      y = 0
+    //      z = z0 + atanh( y0/x0 )
+    //-----------------------------------------------------
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring_xy( const T& x0, const T& y0, T& x, T& y ) const
+{
+    //-----------------------------------------------------
+    // input ranges allowed:
+    //      -2  <= x0 <= 2
+    //      -2  <= y0 <= 2
+    //-----------------------------------------------------
+    const T TWO = _two_fxd;
+    const T PI  = _pi_fxd;
+    if ( debug ) printf( "hyperbolic_vectoring_xy begin: xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "] xy=[%.30f,%.30f]\n",
+                         x0, y0, _to_flt(x0, false, true), _to_flt(y0, false, true) );
+    cassert( x0 >= -TWO && x0 <= TWO, "hyperbolic_vectoring_xy x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -TWO && y0 <= TWO, "hyperbolic_vectoring_xy y0 must be in the range -2 .. 2" );
+
+    //-----------------------------------------------------
+    // d = (y < 0) ? 1 : -1
+    // xi = x - d*(y >> i)
+    // yi = y + d*(x >> i)
+    //-----------------------------------------------------
+    x = x0;
+    y = y0;
+    if constexpr ( CORE::is_static ) {
+        if ( _shortcut_i == 0 && iter_n( _n ) == CORE::n_c ) {
+            CORE::hyperbolic_vectoring_xy( x, y );
+            return;
+        }
+    }
+    uint32_t n = iter_shortcut_n();
+    uint32_t next_dup_i = 4;     
+    for( uint32_t i = 1; i <= n; i++ )
+    {
+        T xi;
+        T yi;
+        if ( debug ) printf( "hyperbolic_vectoring_xy: i=%2d xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "] xy=[%.30f,%.30f] test=%d\n", 
+                             i, x, y, _to_flt(x, false, true), _to_flt(y, false, true), int(y < 0) );
+        if ( y < 0 ) {
+            xi = x + (y >> i);
+            yi = y + (x >> i);
+        } else {
+            xi = x - (y >> i);
+            yi = y - (x >> i);
+        }
+        x = xi;
+        y = yi;
+
+        if ( i == next_dup_i ) {
+            // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
+            next_dup_i = 3*i + 1;
+            i--;
+        }
+    }
+
+    if ( _shortcut_i != 0 ) {
+        y = 0;                          // x is already gain*sqrt(...) to within the lsb
+    }
+
+    //-----------------------------------------------------
+    // hyperbolic vectoring mode results after step n:
+    //      x = gain*sqrt(x0^2 - y0^2)                  gain=0.828159...
+    //      y = 0
+    //-----------------------------------------------------
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_rotation( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    //-----------------------------------------------------
+    // input ranges allowed:
+    //      -2    <= x0 <= 2
+    //      -2    <= y0 <= 2
+    //      |z0|  <= 1
+    //-----------------------------------------------------
+    const T ONE = _one_fxd;
+    const T TWO = _two_fxd;
+    if ( debug ) printf( "linear_rotation begin: xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f]\n",
+                         x0, y0, z0, _to_flt(x0, false, true), _to_flt(y0, false, true), _to_flt(z0, false, true) );
+    cassert( x0 >= -TWO && x0 <= TWO, "linear_rotation x0 must be in the range -2 .. 2" );
+    cassert( y0 >= -TWO && y0 <= TWO, "linear_rotation y0 must be in the range -2 .. 2" );
+    //cassert( z0 >= -ONE && z0 <= ONE, "linear_rotation z0 must be in the range -1 .. 1" );
+    
+    //-----------------------------------------------------
+    // d = (z >= 0) ? 1 : -1
+    // xi = x 
+    // yi = y + d*(x >> i)
+    // zi = z - d*2^(-i)
+    //-----------------------------------------------------
+    x = x0;
+    y = y0;
+    z = z0;
+    if constexpr ( CORE::is_static ) {
+        if ( iter_n( _n ) == CORE::n_c ) {
+            CORE::linear_rotation( x, y, z );
+            return;
+        }
+    }
+    uint32_t n = iter_n( _n );
+    T pow2 = ONE;
+    for( uint32_t i = 0; i <= n; i++, pow2 >>= 1 )
+    {
+        if ( debug ) printf( "linear_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
+                             i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(z >= 0) );
+        T yi;
+        T zi;
+        if ( z >= 0 ) {
+            yi = y + (x >> i);
+            zi = z - pow2;
+        } else {
+            yi = y - (x >> i);
+            zi = z + pow2;
+        }
+        y = yi;
+        z = zi;
+    }
+
+    //-----------------------------------------------------
+    // linear rotation mode results after step n:
+    //      x = x0
+    //      y = y0 + x0*z0
+    //      z = 0
+    //-----------------------------------------------------
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_vectoring( const T& x0, const T& y0, const T& z0, T& x, T& y, T& z ) const
+{
+    //-----------------------------------------------------
+    // input ranges allowed:
     //      -2      <= x0 <= 2
     //      -2      <= y0 <= 2
     //      |y0/x0| <= 1
@@ -2078,84 +4028,364 @@ void Cordic<T,FLT>::linear_vectoring( const T& x0, const T& y0, const T& z0, T&
     //                                    "linear_vectoring y0/x0 must be in the range -1 .. 1" );
     
     //-----------------------------------------------------
-    // d = (y < 0) ? 1 : -1
-    // xi = x
-    // yi = y + d*(x >> i)
-    // zi = z - d*2^(-i)
+    // d = (y < 0) ? 1 : -1
+    // xi = x
+    // yi = y + d*(x >> i)
+    // zi = z - d*2^(-i)
+    //-----------------------------------------------------
+    x = x0;
+    y = y0;
+    z = z0;
+    if constexpr ( CORE::is_static ) {
+        if ( iter_n( _n ) == CORE::n_c ) {
+            CORE::linear_vectoring( x, y, z );
+            return;
+        }
+    }
+    uint32_t n = iter_n( _n );
+    T pow2 = ONE;
+    for( uint32_t i = 0; i <= n; i++, pow2 >>= 1 )
+    {
+        if ( debug ) printf( "linear_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
+                             i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(y < 0) );
+        T yi;
+        T zi;
+        if ( y < 0 ) {
+            yi = y + (x >> i);
+            zi = z - pow2;
+        } else {
+            yi = y - (x >> i);
+            zi = z + pow2;
+        }
+        y = yi;
+        z = zi;
+    }
+
+    //-----------------------------------------------------
+    // linear vectoring mode results after step n:
+    //      x = x0
+    //      y = 0
+    //      z = z0 + y0/x0
+    //-----------------------------------------------------
+}
+
+//-----------------------------------------------------
+// The Batch CORDIC Functions
+//
+// All eight modes share one iteration, written with d = 0 or -1 (all 1's):
+//
+//      d  = is_vectoring ? ((y < 0) ? 0 : -1) : ((z < 0) ? -1 : 0)
+//      xi = x -/+ cneg(y >> i, d)      (circular: -, hyperbolic: +, linear: x unchanged)
+//      yi = y + cneg(x >> i, d)
+//      zi = z - cneg(a[i], d)          where cneg(v, d) = (v ^ d) - d = d ? -v : v
+//
+// which is the same as the if/else in the scalar versions above.
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_rotation( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    batch<KIND::CIRCULAR, false>( cnt, x0, y0, z0, x, y, z );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    batch<KIND::CIRCULAR, true>( cnt, x0, y0, z0, x, y, z );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::circular_vectoring_xy( size_t cnt, const T * x0, const T * y0, T * x, T * y ) const
+{
+    batch<KIND::CIRCULAR, true>( cnt, x0, y0, nullptr, x, y, nullptr );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_rotation( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    batch<KIND::HYPERBOLIC, false>( cnt, x0, y0, z0, x, y, z );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    batch<KIND::HYPERBOLIC, true>( cnt, x0, y0, z0, x, y, z );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hyperbolic_vectoring_xy( size_t cnt, const T * x0, const T * y0, T * x, T * y ) const
+{
+    batch<KIND::HYPERBOLIC, true>( cnt, x0, y0, nullptr, x, y, nullptr );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_rotation( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    batch<KIND::LINEAR, false>( cnt, x0, y0, z0, x, y, z );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::linear_vectoring( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    batch<KIND::LINEAR, true>( cnt, x0, y0, z0, x, y, z );
+}
+
+template< typename T, typename FLT, typename CORE >
+template< typename Cordic<T,FLT,CORE>::KIND kind, bool is_vectoring >
+inline void Cordic<T,FLT,CORE>::batch( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    if ( debug ) printf( "batch begin: kind=%d is_vectoring=%d cnt=%d\n", int(kind), int(is_vectoring), int(cnt) );
+    cassert( (z0 == nullptr) == (z == nullptr), "batch z0 and z must both be given or both be nullptr" );
+
+    if ( kind != KIND::LINEAR && ((_radix == 4 && !is_vectoring) || _shortcut_i != 0) ) {
+        // the batch code is radix-2 and full-length only
+        for( size_t k = 0; k < cnt; k++ )
+        {
+            T zk;
+            if ( kind == KIND::CIRCULAR ) {
+                if ( !is_vectoring ) {
+                    circular_rotation( x0[k], y0[k], z0[k], x[k], y[k], zk );
+                } else if ( z != nullptr ) {
+                    circular_vectoring( x0[k], y0[k], z0[k], x[k], y[k], zk );
+                } else {
+                    circular_vectoring_xy( x0[k], y0[k], x[k], y[k] );
+                }
+            } else {
+                if ( !is_vectoring ) {
+                    hyperbolic_rotation( x0[k], y0[k], z0[k], x[k], y[k], zk );
+                } else if ( z != nullptr ) {
+                    hyperbolic_vectoring( x0[k], y0[k], z0[k], x[k], y[k], zk );
+                } else {
+                    hyperbolic_vectoring_xy( x0[k], y0[k], x[k], y[k] );
+                }
+            }
+            if ( z != nullptr ) z[k] = zk;
+        }
+        return;
+    }
+
+    size_t k = 0;
+#if defined(__AVX512F__)
+    if constexpr ( std::is_same<T, int64_t>::value ) k = batch_avx512<kind, is_vectoring>( cnt, x0, y0, z0, x, y, z );
+#elif defined(__AVX2__)
+    if constexpr ( std::is_same<T, int64_t>::value ) k = batch_avx2<kind, is_vectoring>( cnt, x0, y0, z0, x, y, z );
+#endif
+    for( ; k < cnt; k += BATCH_LANES )
+    {
+        size_t m = std::min( cnt - k, BATCH_LANES );
+        batch_block<kind, is_vectoring>( m, x0+k, y0+k, (z0 != nullptr) ? (z0+k) : nullptr, 
+                                            x+k,  y+k,  (z  != nullptr) ? (z+k)  : nullptr );
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+template< typename Cordic<T,FLT,CORE>::KIND kind, bool is_vectoring >
+inline void Cordic<T,FLT,CORE>::batch_block( size_t m, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    //-----------------------------------------------------
+    // Portable version: up to BATCH_LANES lanes held in local arrays.
+    //-----------------------------------------------------
+    const T TWO = _two_fxd;
+    T xx[BATCH_LANES];
+    T yy[BATCH_LANES];
+    T zz[BATCH_LANES];
+    bool has_z = z0 != nullptr;
+    for( size_t l = 0; l < m; l++ )
+    {
+        cassert( x0[l] >= -3*TWO && x0[l] <= 3*TWO, "batch x0 out of range" );
+        cassert( y0[l] >= -TWO   && y0[l] <= TWO,   "batch y0 out of range" );
+        xx[l] = x0[l];
+        yy[l] = y0[l];
+        zz[l] = has_z ? z0[l] : T(0);
+    }
+
+    uint32_t n = iter_n( _n );
+    uint32_t next_dup_i = 4;
+    for( uint32_t i = (kind == KIND::HYPERBOLIC) ? 1 : 0; i <= n; i++ )
+    {
+        const T a = (kind == KIND::CIRCULAR)   ? _circular_atan_fxd[i]    :
+                    (kind == KIND::HYPERBOLIC) ? _hyperbolic_atanh_fxd[i] : (_one_fxd >> i);
+        for( size_t l = 0; l < m; l++ )
+        {
+            if constexpr ( std::is_integral<T>::value ) {
+                constexpr uint32_t SIGN = 8*sizeof(T) - 1;
+                const T d  = is_vectoring ? ~(yy[l] >> SIGN) : (zz[l] >> SIGN);
+                const T ys = ((yy[l] >> i) ^ d) - d;
+                const T xs = ((xx[l] >> i) ^ d) - d;
+                if ( kind == KIND::CIRCULAR )   xx[l] -= ys;
+                if ( kind == KIND::HYPERBOLIC ) xx[l] += ys;
+                yy[l] += xs;
+                zz[l] -= (a ^ d) - d;
+            } else {
+                const bool d  = is_vectoring ? !(yy[l] < 0) : (zz[l] < 0);
+                const T    ys = d ? -(yy[l] >> i) : (yy[l] >> i);
+                const T    xs = d ? -(xx[l] >> i) : (xx[l] >> i);
+                if ( kind == KIND::CIRCULAR )   xx[l] -= ys;
+                if ( kind == KIND::HYPERBOLIC ) xx[l] += ys;
+                yy[l] += xs;
+                zz[l] -= d ? -a : a;
+            }
+        }
+
+        if ( kind == KIND::HYPERBOLIC && i == next_dup_i ) {
+            // for hyperbolic, we must duplicate iterations 4, 13, 40, 121, ..., 3*i+1
+            next_dup_i = 3*i + 1;
+            i--;
+        }
+    }
+
+    for( size_t l = 0; l < m; l++ )
+    {
+        x[l] = xx[l];
+        y[l] = yy[l];
+        if ( has_z ) z[l] = zz[l];
+    }
+}
+
+#if defined(__AVX512F__)
+template< typename T, typename FLT, typename CORE >
+template< typename Cordic<T,FLT,CORE>::KIND kind, bool is_vectoring >
+inline size_t Cordic<T,FLT,CORE>::batch_avx512( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
+    //-----------------------------------------------------
+    // 8 int64_t lanes per __m512i.  Returns how many triples were done (a multiple of 8).
     //-----------------------------------------------------
-    x = x0;
-    y = y0;
-    z = z0;
-    uint32_t n = _n;
-    T pow2 = ONE;
-    for( uint32_t i = 0; i <= n; i++, pow2 >>= 1 )
+    const bool    has_z = z0 != nullptr;
+    const __m512i ZERO  = _mm512_setzero_si512();
+    const __m512i ONES  = _mm512_set1_epi64( -1 );
+    size_t k = 0;
+    for( ; (k + 8) <= cnt; k += 8 )
     {
-        if ( debug ) printf( "linear_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "] xyz=[%.30f,%.30f,%.30f] test=%d\n", 
-                             i, x, y, z, _to_flt(x, false, true), _to_flt(y, false, true), _to_flt(z, false, true), int(y < 0) );
-        T yi;
-        T zi;
-        if ( y < 0 ) {
-            yi = y + (x >> i);
-            zi = z - pow2;
-        } else {
-            yi = y - (x >> i);
-            zi = z + pow2;
+        __m512i vx = _mm512_loadu_si512( x0 + k );
+        __m512i vy = _mm512_loadu_si512( y0 + k );
+        __m512i vz = has_z ? _mm512_loadu_si512( z0 + k ) : ZERO;
+
+        uint32_t n = iter_n( _n );
+        uint32_t next_dup_i = 4;
+        for( uint32_t i = (kind == KIND::HYPERBOLIC) ? 1 : 0; i <= n; i++ )
+        {
+            const T a = (kind == KIND::CIRCULAR)   ? _circular_atan_fxd[i]    :
+                        (kind == KIND::HYPERBOLIC) ? _hyperbolic_atanh_fxd[i] : (_one_fxd >> i);
+            const __m128i sh = _mm_cvtsi32_si128( int(i) );
+            const __m512i d  = is_vectoring ? _mm512_xor_si512( _mm512_srai_epi64( vy, 63 ), ONES ) : _mm512_srai_epi64( vz, 63 );
+            const __m512i ys = _mm512_sub_epi64( _mm512_xor_si512( _mm512_sra_epi64( vy, sh ), d ), d );
+            const __m512i xs = _mm512_sub_epi64( _mm512_xor_si512( _mm512_sra_epi64( vx, sh ), d ), d );
+            const __m512i va = _mm512_set1_epi64( a );
+            if ( kind == KIND::CIRCULAR )   vx = _mm512_sub_epi64( vx, ys );
+            if ( kind == KIND::HYPERBOLIC ) vx = _mm512_add_epi64( vx, ys );
+            vy = _mm512_add_epi64( vy, xs );
+            vz = _mm512_sub_epi64( vz, _mm512_sub_epi64( _mm512_xor_si512( va, d ), d ) );
+
+            if ( kind == KIND::HYPERBOLIC && i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                i--;
+            }
         }
-        y = yi;
-        z = zi;
+
+        _mm512_storeu_si512( x + k, vx );
+        _mm512_storeu_si512( y + k, vy );
+        if ( has_z ) _mm512_storeu_si512( z + k, vz );
     }
+    return k;
+}
 
+#elif defined(__AVX2__)
+template< typename T, typename FLT, typename CORE >
+template< typename Cordic<T,FLT,CORE>::KIND kind, bool is_vectoring >
+inline size_t Cordic<T,FLT,CORE>::batch_avx2( size_t cnt, const T * x0, const T * y0, const T * z0, T * x, T * y, T * z ) const
+{
     //-----------------------------------------------------
-    // linear vectoring mode results after step n:
-    //      x = x0
-    //      y = 0
-    //      z = z0 + y0/x0
+    // 4 int64_t lanes per __m256i.  Returns how many triples were done (a multiple of 4).
+    //
+    // AVX2 has no 64-bit arithmetic right shift, so v >> i is done as ((v ^ s) >>> i) ^ s
+    // where s is the sign mask of v and >>> is a logical shift.
     //-----------------------------------------------------
+    const bool    has_z = z0 != nullptr;
+    const __m256i ZERO  = _mm256_setzero_si256();
+    const __m256i ONES  = _mm256_set1_epi64x( -1 );
+    size_t k = 0;
+    for( ; (k + 4) <= cnt; k += 4 )
+    {
+        __m256i vx = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( x0 + k ) );
+        __m256i vy = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( y0 + k ) );
+        __m256i vz = has_z ? _mm256_loadu_si256( reinterpret_cast<const __m256i *>( z0 + k ) ) : ZERO;
+
+        uint32_t n = iter_n( _n );
+        uint32_t next_dup_i = 4;
+        for( uint32_t i = (kind == KIND::HYPERBOLIC) ? 1 : 0; i <= n; i++ )
+        {
+            const T a = (kind == KIND::CIRCULAR)   ? _circular_atan_fxd[i]    :
+                        (kind == KIND::HYPERBOLIC) ? _hyperbolic_atanh_fxd[i] : (_one_fxd >> i);
+            const __m128i sh = _mm_cvtsi32_si128( int(i) );
+            const __m256i sx = _mm256_cmpgt_epi64( ZERO, vx );
+            const __m256i sy = _mm256_cmpgt_epi64( ZERO, vy );
+            const __m256i d  = is_vectoring ? _mm256_cmpgt_epi64( vy, ONES ) : _mm256_cmpgt_epi64( ZERO, vz );
+            const __m256i yr = _mm256_xor_si256( _mm256_srl_epi64( _mm256_xor_si256( vy, sy ), sh ), sy );
+            const __m256i xr = _mm256_xor_si256( _mm256_srl_epi64( _mm256_xor_si256( vx, sx ), sh ), sx );
+            const __m256i ys = _mm256_sub_epi64( _mm256_xor_si256( yr, d ), d );
+            const __m256i xs = _mm256_sub_epi64( _mm256_xor_si256( xr, d ), d );
+            const __m256i va = _mm256_set1_epi64x( a );
+            if ( kind == KIND::CIRCULAR )   vx = _mm256_sub_epi64( vx, ys );
+            if ( kind == KIND::HYPERBOLIC ) vx = _mm256_add_epi64( vx, ys );
+            vy = _mm256_add_epi64( vy, xs );
+            vz = _mm256_sub_epi64( vz, _mm256_sub_epi64( _mm256_xor_si256( va, d ), d ) );
+
+            if ( kind == KIND::HYPERBOLIC && i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                i--;
+            }
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i *>( x + k ), vx );
+        _mm256_storeu_si256( reinterpret_cast<__m256i *>( y + k ), vy );
+        if ( has_z ) _mm256_storeu_si256( reinterpret_cast<__m256i *>( z + k ), vz );
+    }
+    return k;
 }
+#endif
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::constructed( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::constructed( const T& x ) const
 {
     if ( logger != nullptr ) logger->constructed( &x, this );
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::destructed( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::destructed( const T& x ) const
 {
     if ( logger != nullptr ) logger->destructed( &x, this );
 }
 
-template< typename T, typename FLT >
-inline T&   Cordic<T,FLT>::assign( T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T&   Cordic<T,FLT,CORE>::assign( T& x, const T& y ) const
 {
     _log_2( assign, x, y );
     x = y;
     return x;
 }
 
-template< typename T, typename FLT >
-inline T&   Cordic<T,FLT>::pop_value( T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T&   Cordic<T,FLT,CORE>::pop_value( T& x, const T& y ) const
 {
     _log_2i( pop_value, x, y );
     x = y;
     return x;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::pop_bool( bool b ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::pop_bool( bool b ) const
 {
     _log_1i( pop_bool, b );
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::signbit( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::signbit( const T& x ) const                                     
 {
     return (x >> (_w-1)) & 1;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::frexp( const T& _x, int * e ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::frexp( const T& _x, int * e ) const
 {
     _log_1( frexp, _x );
     switch( fpclassify( _x ) )
@@ -2183,8 +4413,8 @@ inline T Cordic<T,FLT>::frexp( const T& _x, int * e ) const
     }
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::modf( const T& _x, T * i ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::modf( const T& _x, T * i ) const
 {
     if ( debug ) std::cout << "modf begin: x=" << _to_flt(_x) << "\n";
     _log_1( modf, _x );
@@ -2250,23 +4480,23 @@ T Cordic<T,FLT>::modf( const T& _x, T * i ) const
     return x;
 }
 
-template< typename T, typename FLT >
-int Cordic<T,FLT>::ilogb( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+int Cordic<T,FLT,CORE>::ilogb( const T& x ) const
 {
     int exp;
     (void)frexp( x, &exp );
     return exp;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::logb( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::logb( const T& x ) const
 {
     int exp = ilogb( x );
     return scalbn( _one, exp );
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::fpclassify( const T& _x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::fpclassify( const T& _x ) const                                     
 {
     T x = _x;
     EXP_CLASS x_exp_class;
@@ -2284,45 +4514,45 @@ inline int Cordic<T,FLT>::fpclassify( const T& _x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::iszero( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::iszero( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_ZERO;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isfinite( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isfinite( const T& x ) const                                     
 {
     int c = fpclassify( x );
     return c != FP_INFINITE && c != FP_NAN;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isinf( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isinf( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_INFINITE;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isnan( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isnan( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_NAN;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isnormal( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isnormal( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_NORMAL;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::issubnormal( const T& x ) const                                     
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::issubnormal( const T& x ) const                                     
 {
     return fpclassify( x ) == FP_SUBNORMAL;
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::fesetround( int round )
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::fesetround( int round )
 {
     switch( round )
     {
@@ -2332,7 +4562,11 @@ inline int Cordic<T,FLT>::fesetround( int round )
         case FE_TOWARDZERO:
         case FE_AWAYFROMZERO:
         case FE_TONEAREST:
-            _rounding_mode = round;
+            if ( _thread_rounding_cordic == this ) {
+                _thread_rounding_mode = round;                  // inside a Parallel chunk: this thread only
+            } else {
+                _rounding_mode = round;
+            }
             return 0;
 
         default:
@@ -2340,14 +4574,297 @@ inline int Cordic<T,FLT>::fesetround( int round )
     }
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::fegetround( void ) const
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::fegetround( void ) const
 {
-    return _rounding_mode;
+    return (_thread_rounding_cordic == this) ? _thread_rounding_mode : _rounding_mode;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nextafter( const T& from, const T& to ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::correctly_rounded_set( bool enable )
+{
+    //-----------------------------------------------------
+    // Correctly-rounded mode (Ziv's strategy):
+    //
+    // Each math function runs without the final rounding, and if its guard bits are more
+    // than its error from a rounding boundary for the current rounding mode, the error
+    // can't change the rounded result, so round and return. Otherwise rerun the function
+    // on the next of the _cr_cordic[] levels, which have the same format but more guard bits
+    // and iterate that much further, and check again.
+    //
+    // The levels step by CR_LEVEL_W guard bits up to all the spare bits in T.
+    // If even the widest one is still within its error of a boundary, there is
+    // nothing wider to ask.  Within 2^CR_ERR_W guard lsbs, the result is taken to be exactly 
+    // on the boundary, which is where exact results such as sqrt(4) or 1.5*1.5 land;
+    // otherwise its unrounded result is the best there is.
+    //
+    // The error of the function itself is about 2^(frac_guard_w-n) guard lsbs plus a few for
+    // the reductions, so it only gets a fast path if it's constructed with n close to
+    // frac_w+guard_w and guard_w > CR_ERR_W+1; with the defaults, every call starts
+    // on the first level, which costs about guard_w+CR_LEVEL_W more iterations.
+    //
+    // Inside a Precision scope the error of the function itself is unknown, so it gets no fast path.
+    // The mode is skipped while a logger is installed, and the r-scaled variants such as
+    // sin( x, &r ) are not covered.
+    //-----------------------------------------------------
+    for( uint32_t i = 0; i < _cr_level_cnt; i++ ) delete _cr_cordic[i];
+    _cr_level_cnt = 0;
+    _cr_fast      = false;
+    if ( !enable ) return;
+
+    const uint32_t int_exp_w   = _int_w | _exp_w;
+    const uint32_t max_guard_w = uint32_t(8*sizeof(T)) - 2 - int_exp_w - _frac_w;   // keep the msb of T clear
+    cassert( int32_t(max_guard_w) >= int32_t(_guard_w + 8), "correctly-rounded mode needs at least 9 spare bits in T beyond 1+int_exp_w+frac_w+guard_w" );
+    uint32_t level_w[CR_LEVEL_MAX];
+    for( uint32_t guard_w = max_guard_w; _cr_level_cnt < CR_LEVEL_MAX && guard_w >= _guard_w + 8; guard_w -= CR_LEVEL_W )
+    {
+        level_w[_cr_level_cnt++] = guard_w;
+        if ( guard_w < CR_LEVEL_W ) break;
+    }
+    for( uint32_t i = 0; i < _cr_level_cnt; i++ )
+    {
+        const uint32_t guard_w = level_w[_cr_level_cnt-1-i];                 // narrowest first
+        _cr_delta_w[i] = guard_w - _guard_w;
+        _cr_cordic[i]  = new Cordic<T,FLT>( int_exp_w, _frac_w, _is_float, guard_w, _frac_w + guard_w, _radix, 0, 0, 0,
+                                            static_cast<typename Cordic<T,FLT>::BACKEND>( _arith_backend ) );
+        _cr_cordic[i]->fesetround( FE_NOROUND );                             // cr_eval() rounds its results
+        _cr_cordic[i]->_cr_err_w = CR_ERR_W;
+    }
+
+    _cr_err_w = std::max( int32_t(_frac_guard_w) - int32_t(_n), 0 ) + CR_ERR_W;
+    _cr_fast  = _cr_err_w < int32_t(_guard_w) - 1;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::correctly_rounded_get( void ) const
+{
+    return _cr_level_cnt != 0;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::FN_KERNEL Cordic<T,FLT,CORE>::fn_kernel( OP op )
+{
+    switch( op )
+    {
+        case OP::sin:
+        case OP::sinpi:
+        case OP::cos:
+        case OP::cospi:
+        case OP::sincos:
+        case OP::sinpicospi:
+        case OP::tan:
+        case OP::tanpi:
+        case OP::polar_to_rect:         return FN_KERNEL::SINCOS;
+
+        case OP::exp:
+        case OP::expm1:
+        case OP::expc:
+        case OP::exp2:
+        case OP::exp10:                 return FN_KERNEL::EXP;
+
+        case OP::log:
+        case OP::logn:
+        case OP::logc:
+        case OP::log10:                 return FN_KERNEL::LOG;
+
+        case OP::atan:
+        case OP::atan2:
+        case OP::rect_to_polar:         return FN_KERNEL::ATAN;
+
+        default:                        return FN_KERNEL::NONE;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+bool Cordic<T,FLT,CORE>::fn_backend_set( OP op, FN_BACKEND backend )
+{
+    const FN_KERNEL kernel = fn_kernel( op );
+    cassert( kernel != FN_KERNEL::NONE || backend == FN_BACKEND::CORDIC, "fn_backend_set: " + op_to_str( uint16_t(op) ) + " has no kernel with other backends" );
+    if ( kernel == FN_KERNEL::NONE || _fn_backend[uint32_t(kernel)] == backend ) return true;
+
+    const FN_BACKEND prev = _fn_backend[uint32_t(kernel)];
+    _fn_backend[uint32_t(kernel)] = backend;
+    FN_APPROX * a = _fn_approx[uint32_t(kernel)];
+    if ( backend == FN_BACKEND::CORDIC ) {
+        for( uint32_t i = 0; i < 2; i++ )
+        {
+            delete[] a[i].coef;
+            a[i].coef = nullptr;
+        }
+        return true;
+    }
+
+    const uint32_t piece_w = (backend == FN_BACKEND::TABLE) ? FN_TABLE_W : 0;
+    switch( kernel )
+    {
+        case FN_KERNEL::SINCOS:
+            fn_approx_build( a[0], []( FLT x ) { return std::cos( x ); }, FLT(0), FLT(M_PI) / FLT(4), piece_w );
+            fn_approx_build( a[1], []( FLT x ) { return std::sin( x ); }, FLT(0), FLT(M_PI) / FLT(4), piece_w );
+            break;
+
+        case FN_KERNEL::EXP:
+            fn_approx_build( a[0], []( FLT x ) { return std::exp( x ); }, FLT(0), std::log( FLT(2) ), piece_w );
+            break;
+
+        case FN_KERNEL::LOG:
+            fn_approx_build( a[0], []( FLT x ) { return std::log( x / FLT(2) ); }, FLT(1), FLT(2), piece_w );
+            break;
+
+        case FN_KERNEL::ATAN:
+            fn_approx_build( a[0], []( FLT x ) { return std::atan( x ); }, FLT(0), FLT(1), piece_w );
+            break;
+
+        default:
+            break;
+    }
+
+    if ( backend == FN_BACKEND::POLY ) {
+        for( uint32_t i = 0; i < 2; i++ )
+        {
+            if ( a[i].coef != nullptr && a[i].deg > FN_POLY_DEG_MAX ) {
+                // a series that long loses to TABLE and can lose to CORDIC, so leave the choice to the caller
+                fn_backend_set( op, FN_BACKEND::CORDIC );
+                fn_backend_set( op, prev );
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::FN_BACKEND Cordic<T,FLT,CORE>::fn_backend_get( OP op ) const
+{
+    const FN_KERNEL kernel = fn_kernel( op );
+    return (kernel == FN_KERNEL::NONE) ? FN_BACKEND::CORDIC : _fn_backend[uint32_t(kernel)];
+}
+
+template< typename T, typename FLT, typename CORE >
+inline int32_t Cordic<T,FLT,CORE>::cr_err_w( const T& r, int32_t extra_w ) const
+{
+    //-----------------------------------------------------
+    // The CORDIC error is mostly absolute, so for floating-point it grows
+    // in guard lsbs as the result exponent drops below 0.
+    //
+    // Returns -1 for results that round to themselves, and _guard_w
+    // when the error can't be bounded within the guard bits.
+    //-----------------------------------------------------
+    int32_t err_w = _cr_err_w + extra_w;
+    if ( _is_float ) {
+        const EXP_CLASS r_exp_class = classify( r );
+        if ( r_exp_class != EXP_CLASS::NORMAL && r_exp_class != EXP_CLASS::SUBNORMAL ) return -1;
+        const int32_t r_exp = int32_t( (r >> _frac_guard_w) & _exp_mask ) - _exp_bias;
+        if ( r_exp_class == EXP_CLASS::SUBNORMAL || r_exp < -int32_t(_guard_w) ) return _guard_w;
+        if ( r_exp < 0 ) err_w -= r_exp;
+    }
+    return std::min( err_w, int32_t(_guard_w) );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::cr_is_ambiguous( const T& r, int rmode, int32_t err_w ) const
+{
+    //-----------------------------------------------------
+    // Nearest rounds at half of the guard range; the others round at zero.
+    //-----------------------------------------------------
+    if ( err_w < 0 ) return false;
+    if ( err_w >= int32_t(_guard_w) - 1 ) return true;
+
+    const T tol = T(1) << err_w;
+    const T g   = r & _guard_mask;
+    if ( rmode == FE_TONEAREST ) {
+        const T half = T(1) << (_guard_w-1);
+        return (g >= half) ? ((g - half) <= tol) : ((half - g) <= tol);
+    }
+    return g <= tol || (_guard_mask - g) < tol;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::cr_snap( T& r, int rmode ) const
+{
+    //-----------------------------------------------------
+    // Move r onto the rounding boundary that cr_is_ambiguous() found it near.
+    // The guard bits are the low bits of the magnitude for floating-point and 
+    // of the 2's complement value for fixed-point, so either way clearing
+    // them or carrying out of them lands on a neighboring representable value.
+    //-----------------------------------------------------
+    const T g = r & _guard_mask;
+    r -= g;
+    if ( rmode == FE_TONEAREST ) {
+        r |= T(1) << (_guard_w-1);
+    } else if ( g > (_guard_mask >> 1) ) {
+        r += _guard_mask + 1;
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+template< typename FN, typename COND_W >
+void Cordic<T,FLT,CORE>::cr_eval( const T * args, uint32_t cnt, int n, T * r, uint32_t r_cnt, FN fn, COND_W cond_w ) const
+{
+    //-----------------------------------------------------
+    // Functions with two results (sincos() etc.) retry both if either is ambiguous.
+    // n is passed through untouched for pown() and rootn().
+    // fn and cond_w take this Cordic or one of the _cr_cordic[] levels, which always
+    // use the default CORE because their formats differ from any CORE's.
+    //-----------------------------------------------------
+    const int rmode = fegetround();
+    if ( rmode == FE_NOROUND ) {
+        _thread_cr_busy = true;
+        fn( this, args, n, r );
+        _thread_cr_busy = false;
+        return;
+    }
+
+    const Cordic<T,FLT,CORE> * prev_rcordic = _thread_rounding_cordic;
+    int                   prev_rmode   = _thread_rounding_mode;
+    _thread_rounding_cordic = this;
+    _thread_rounding_mode   = FE_NOROUND;
+    _thread_cr_busy = true;
+    bool done = false;
+    if ( _cr_fast && _thread_prec_cordic != this ) {                   // a Precision scope voids _cr_err_w
+        fn( this, args, n, r );
+        done = true;
+        for( uint32_t i = 0; i < r_cnt && done; i++ )
+        {
+            done = !cr_is_ambiguous( r[i], rmode, cr_err_w( r[i], isfinite( r[i] ) ? cond_w( this, r[i] ) : 0 ) );
+        }
+        if ( done ) {
+            for( uint32_t i = 0; i < r_cnt; i++ ) r[i] = rfrac( r[i], rmode );
+        }
+    }
+    for( uint32_t l = 0; l < _cr_level_cnt && !done; l++ )
+    {
+        //-----------------------------------------------------
+        // The formats differ only in the number of guard bits, so moving between
+        // them is a shift either way; once the level has rounded, the shift back is exact.
+        //-----------------------------------------------------
+        const Cordic<T,FLT> * c = _cr_cordic[l];
+        const bool is_widest = l == (_cr_level_cnt-1);
+        T wide[3];
+        for( uint32_t i = 0; i < cnt; i++ ) wide[i] = args[i] << _cr_delta_w[l];
+        fn( c, wide, n, r );
+        done = true;
+        for( uint32_t i = 0; i < r_cnt && done; i++ )
+        {
+            const int32_t err_w = c->cr_err_w( r[i], c->isfinite( r[i] ) ? cond_w( c, r[i] ) : 0 );
+            if ( c->cr_is_ambiguous( r[i], rmode, err_w ) ) {
+                if ( !is_widest ) {
+                    done = false;
+                } else if ( c->cr_is_ambiguous( r[i], rmode, c->_cr_err_w ) ) {
+                    c->cr_snap( r[i], rmode );                          // nothing wider to ask, and this close it's taken to be exact
+                }
+            }
+        }
+        if ( done ) {
+            for( uint32_t i = 0; i < r_cnt; i++ ) r[i] = c->rfrac( r[i], rmode ) >> _cr_delta_w[l];
+        }
+    }
+    _thread_cr_busy = false;
+    _thread_rounding_cordic = prev_rcordic;
+    _thread_rounding_mode   = prev_rmode;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nextafter( const T& from, const T& to ) const
 {
     _log_2( nextafter, from, to );
     if ( isequal( from, to ) ) {
@@ -2359,14 +4876,14 @@ inline T Cordic<T,FLT>::nextafter( const T& from, const T& to ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nexttoward( const T& from, long double to ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nexttoward( const T& from, long double to ) const
 {
     return nextafter( from, to_t(to) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::floor( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::floor( const T& x ) const
 {
     _log_1( floor, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2381,8 +4898,8 @@ inline T Cordic<T,FLT>::floor( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::ceil( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ceil( const T& x ) const
 {
     _log_1( ceil, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2397,8 +4914,8 @@ inline T Cordic<T,FLT>::ceil( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::trunc( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::trunc( const T& x ) const
 {
     _log_1( trunc, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2413,8 +4930,8 @@ inline T Cordic<T,FLT>::trunc( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::extend( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::extend( const T& x ) const
 {
     _log_1( extend, x );
     if ( (x & _frac_guard_mask) == 0 ) {
@@ -2430,8 +4947,8 @@ inline T Cordic<T,FLT>::extend( const T& x ) const
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::round( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::round( const T& x ) const
 {
     _log_1( round, x );
     T i;
@@ -2440,31 +4957,31 @@ inline T Cordic<T,FLT>::round( const T& x ) const
     return f;
 }
 
-template< typename T, typename FLT >
-inline long Cordic<T,FLT>::lround( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long Cordic<T,FLT,CORE>::lround( const T& x ) const
 {
     // use round(), then convert to FLT and then integer
     return FLT( round( x ) );
 }
 
-template< typename T, typename FLT >
-inline long long Cordic<T,FLT>::llround( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long long Cordic<T,FLT,CORE>::llround( const T& x ) const
 {
     // use round(), then convert to FLT and then integer
     return FLT( round( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::iround( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::iround( const T& x ) const
 {
     // same as round(), then convert to FLT and then integer
     return FLT( round( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rint( const T& x, int rmode ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rint( const T& x, int rmode ) const
 {
-    if ( rmode < 0 ) rmode = _rounding_mode;
+    if ( rmode < 0 ) rmode = fegetround();
 
     switch( rmode )
     {
@@ -2478,37 +4995,37 @@ inline T Cordic<T,FLT>::rint( const T& x, int rmode ) const
     }
 }
 
-template< typename T, typename FLT >
-inline long Cordic<T,FLT>::lrint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long Cordic<T,FLT,CORE>::lrint( const T& x ) const
 {
     // use rint() then convert to FLT and then integer
     return FLT( rint( x ) );
 }
 
-template< typename T, typename FLT >
-inline long long Cordic<T,FLT>::llrint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline long long Cordic<T,FLT,CORE>::llrint( const T& x ) const
 {
     // use rint() then convert to FLT and then integer
     return FLT( rint( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::irint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::irint( const T& x ) const
 {
     // use rint() then convert to FLT and then integer
     return FLT( rint( x ) );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::nearbyint( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::nearbyint( const T& x ) const
 {
     return rint( x );                   // needs to make sure FE_INEXACT doesn't get raised
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rfrac( const T& _x, int rmode ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rfrac( const T& _x, int rmode ) const
 {
-    if ( rmode < 0 ) rmode = _rounding_mode;
+    if ( rmode < 0 ) rmode = fegetround();
 
     T x = _x;
     T guard = x & _guard_mask;
@@ -2527,7 +5044,7 @@ inline T Cordic<T,FLT>::rfrac( const T& _x, int rmode ) const
         case FE_UPWARD:         if ( !x_sign ) x += _min_fxd;                           break;
         case FE_TOWARDZERO:                                                             break;
         case FE_AWAYFROMZERO:   x += x_sign ? -_min_fxd : _min_fxd;                     break;
-        case FE_TONEAREST:      if ( guard >= (1 << (_guard_w-1)) ) x += _min_fxd;      break;
+        case FE_TONEAREST:      if ( guard >= (T(1) << (_guard_w-1)) ) x += _min_fxd;   break;
         default:                                                                        break;
     }
 
@@ -2536,23 +5053,23 @@ inline T Cordic<T,FLT>::rfrac( const T& _x, int rmode ) const
     return x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::floorfrac( const T& x ) const    { return rfrac( x, FE_DOWNWARD ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::floorfrac( const T& x ) const    { return rfrac( x, FE_DOWNWARD ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::ceilfrac( const T& x ) const     { return rfrac( x, FE_UPWARD ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::ceilfrac( const T& x ) const     { return rfrac( x, FE_UPWARD ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::truncfrac( const T& x ) const    { return rfrac( x, FE_TOWARDZERO ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::truncfrac( const T& x ) const    { return rfrac( x, FE_TOWARDZERO ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::extendfrac( const T& x ) const   { return rfrac( x, FE_AWAYFROMZERO ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::extendfrac( const T& x ) const   { return rfrac( x, FE_AWAYFROMZERO ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::roundfrac( const T& x ) const    { return rfrac( x, FE_TONEAREST ); }
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::roundfrac( const T& x ) const    { return rfrac( x, FE_TONEAREST ); }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::neg( const T& x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::neg( const T& x, bool is_final ) const
 {
     if ( is_final ) _log_1( neg, x );
     T x_neg;
@@ -2569,14 +5086,14 @@ inline T Cordic<T,FLT>::neg( const T& x, bool is_final ) const
     return x_neg;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::neg( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::neg( const T& x ) const
 {
     return neg( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::abs( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::abs( const T& x ) const
 {
     _log_1( abs, x );
     T x_abs = x;
@@ -2584,8 +5101,8 @@ inline T Cordic<T,FLT>::abs( const T& x ) const
     return x_abs;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::copysign( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::copysign( const T& x, const T& y ) const
 {
     _log_2( copysign, x, y );
     bool x_sign = signbit( x );
@@ -2593,32 +5110,32 @@ inline T Cordic<T,FLT>::copysign( const T& x, const T& y ) const
     return (x_sign != y_sign) ? neg( x, false ) : x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::add( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::add( const T& x, const T& y ) const
 {
 
     return add( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sub( const T& x, const T& y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sub( const T& x, const T& y, bool is_final ) const
 {
     return add( x, neg( y, false ), is_final );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sub( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sub( const T& x, const T& y ) const
 {
     return sub( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::add( const T& _x, const T& _y, bool is_final ) const
 {
     if ( is_final ) _log_2( add, _x, _y );
     T x = _x;  // will also contain the result
     T y = _y;
-    if ( _is_float ) {
+    if ( fmt_is_float() ) {
         // FLOAT: normalize to largest of two exponents
         //
         EXP_CLASS x_exp_class;
@@ -2645,14 +5162,14 @@ inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
             // x is the answer, but could change to quiet_NaN 
             if ( x_sign != y_sign && y_exp_class == EXP_CLASS::INFINITE ) {
                 x_exp_class = EXP_CLASS::NOT_A_NUMBER;
-                x |= _quiet_NaN_fxd;
+                x |= fmt_quiet_NaN_fxd();
             }
 
         } else if ( y_exp_class == EXP_CLASS::INFINITE ) {
             // y is the answer, but could change to quiet_NaN 
             if ( x_sign != y_sign && x_exp_class == EXP_CLASS::INFINITE ) {
                 y_exp_class = EXP_CLASS::NOT_A_NUMBER;
-                y |= _quiet_NaN_fxd;
+                y |= fmt_quiet_NaN_fxd();
             }
             x_exp_class = y_exp_class;
             x_exp       = y_exp;
@@ -2673,26 +5190,23 @@ inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
             if ( x == 0 ) {
                 x_exp_class = EXP_CLASS::ZERO;
                 x_exp = 0;
-            } else if ( x >= _two_fxd ) {
-                cassert( x < _four_fxd, "add() sum of mantissas should have been less than 4" );
+            } else if ( x >= fmt_two_fxd() ) {
+                cassert( x < fmt_four_fxd(), "add() sum of mantissas should have been less than 4" );
                 cassert( x_exp_class == EXP_CLASS::NORMAL || x_exp_class == EXP_CLASS::SUBNORMAL, "add() expected NORMAL or SUBNORMAL class x value at this point" );
                 x_exp++;
                 x = (x >> 1) | (x & 1); // perhaps set sticky bit
-                if ( x_exp >= _exp_unbiased_max ) {
+                if ( x_exp >= fmt_exp_unbiased_max() ) {
                     x_exp_class = EXP_CLASS::INFINITE;
-                    x_exp = _exp_mask;
+                    x_exp = fmt_exp_mask();
                     x = 0;
                 }
-            } else if ( x >= _one_fxd && x_exp_class == EXP_CLASS::SUBNORMAL ) {
-                x_exp_class = EXP_CLASS::NORMAL;
-                x_exp = 0;
-            } else if ( x < _one_fxd ) {
-                while( x < _one_fxd && x_exp > _exp_unbiased_min )
-                {
-                    x_exp--;
-                    x <<= 1;
-                }
-                x_exp_class = (x_exp == _exp_unbiased_min) ? EXP_CLASS::SUBNORMAL : EXP_CLASS::NORMAL;
+            } else if ( x >= fmt_one_fxd() && x_exp_class == EXP_CLASS::SUBNORMAL ) {
+                x_exp_class = EXP_CLASS::NORMAL;                            // x_exp is already that of the smallest normal
+            } else if ( x < fmt_one_fxd() ) {
+                int32_t shift = std::min( clz( x ) - fmt_one_fxd_clz(), x_exp - fmt_exp_unbiased_min() );
+                x_exp -= shift;
+                x    <<= shift;
+                x_exp_class = (x_exp == fmt_exp_unbiased_min()) ? EXP_CLASS::SUBNORMAL : EXP_CLASS::NORMAL;
             }
         }
 
@@ -2704,14 +5218,14 @@ inline T Cordic<T,FLT>::add( const T& _x, const T& _y, bool is_final ) const
         bool x_sign = x < 0;
         bool y_sign = y < 0;
              x     += y;
-        T    sign_mask = x >> (_w - 1);
+        T    sign_mask = x >> (fmt_w() - 1);
         cassert( sign_mask == T(0) || sign_mask == T(-1), "add caused overflow" );
     }
     return x;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::scalbn( const T& _x, int ls, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::scalbn( const T& _x, int ls, bool is_final ) const
 {
     if ( is_final ) _log_2i( scalbn, _x, T(ls) );
     T         x = _x;
@@ -2731,26 +5245,26 @@ T Cordic<T,FLT>::scalbn( const T& _x, int ls, bool is_final ) const
     return x;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::scalbn( const T& x, int ls ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::scalbn( const T& x, int ls ) const
 {
     return scalbn( x, ls, true );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::scalbnn( const T& x, int rs ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::scalbnn( const T& x, int rs ) const
 {
     return scalbn( x, -rs, true );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::ldexp( const T& x, int y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::ldexp( const T& x, int y ) const
 {
     return scalbn( x, y );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T& addend, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fma_fda( bool is_fma, const T& _x, const T& _y, const T& addend, bool is_final ) const
 {
     bool have_addend = !iszero( addend );
     if ( is_final ) {
@@ -2761,7 +5275,7 @@ inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T&
     }
     T x = _x;
     T y = _y;
-    std::string kind = is_fma ? "fma" : "fda";
+    const char * kind = is_fma ? "fma" : "fda";
     if ( debug ) std::cout << kind << " begin: x_orig=" << _to_flt(x, is_final) << 
                                         " y_orig=" << _to_flt(y, is_final) << 
                                         " addend=" << _to_flt(addend, is_final) << "\n";
@@ -2830,7 +5344,15 @@ inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T&
 
     } else {
         T xx, yy, zz;
-        if ( is_fma ) {
+        if ( _arith_backend == BACKEND::NATIVE && is_fma ) {
+            rr = mul_fxd( x, y );
+        } else if ( _arith_backend == BACKEND::NATIVE ) {
+            // normalize subnormal x
+            int32_t shift = clz( x ) - _one_fxd_clz;
+            x   <<= shift;
+            x_exp -= shift;
+            rr = div_fxd_nr( y, x );
+        } else if ( is_fma ) {
             linear_rotation( x, _zero, y, xx, rr, zz );
         } else {
             linear_vectoring( x, y, _zero, xx, yy, rr );
@@ -2847,6 +5369,8 @@ inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T&
     if ( do_rest ) {
         if ( have_addend ) rr = add( rr, addend, false );
         if ( is_final ) rr = rfrac( rr );
+    } else if ( have_addend && rr_exp_class == EXP_CLASS::ZERO ) {
+        rr = addend;                                                    // 0*y + addend or 0/x + addend
     }
 
     if ( debug ) std::cout << kind << " end: x_orig=" << _to_flt(_x, is_final) << 
@@ -2859,41 +5383,83 @@ inline T Cordic<T,FLT>::fma_fda( bool is_fma, const T& _x, const T& _y, const T&
     return rr;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fma( const T& x, const T& y, const T& addend ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fma( const T& x, const T& y, const T& addend ) const
 {
+    _cr_3( fma, x, y, addend );
     return fma_fda( true, x, y, addend, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mul( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul( const T& x, const T& y ) const
 {
+    _cr_2( mul, x, y );
     return fma( x, y, _zero );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mul( const T& x, const T& y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mul( const T& x, const T& y, bool is_final ) const
 {
     return fma_fda( true, x, y, _zero, is_final );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mulc( const T& x, const T& c, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const T& c, bool is_final ) const
 {
+    // plain mul(); internal callers name their constant with MULC and get its plan directly
     if ( is_final ) _log_2i( mulc, x, c );
-    T r = mul( x, c, false );     // later, change this to minimum shifts and adds
+    T r = mul( x, c, false );
     if ( is_final ) r = rfrac( r );
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::mulc( const T& x, const T& c ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, MULC c, bool is_final ) const
+{
+    const MULC_PLAN * plan = &_mulc_plan[uint32_t(c)];
+    return mulc( x, plan->c, plan, is_final );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const T& c, const MULC_PLAN * plan, bool is_final ) const
+{
+    if ( plan != nullptr && plan->digit_cnt != 0 && _arith_backend == BACKEND::CORDIC ) {
+        // a native multiply is already cheaper than the shift/adds
+        T m = x;
+        EXP_CLASS m_exp_class;
+        int32_t   m_exp;
+        bool      m_sign;
+        deconstruct( m, m_exp_class, m_exp, m_sign );
+        if ( m_exp_class == EXP_CLASS::NORMAL || m_exp_class == EXP_CLASS::SUBNORMAL ) {
+            const T mm = m << _mulc_headroom_w;
+            T rr = 0;
+            for( uint32_t i = 0; i < plan->digit_cnt; i++ )
+            {
+                int32_t s = plan->digit_shift[i];
+                T       t = (s >= 0) ? (mm >> s) : (mm << -s);
+                rr = plan->digit_neg[i] ? (rr - t) : (rr + t);
+            }
+            if ( _mulc_headroom_w != 0 ) rr = (rr + (T(1) << (_mulc_headroom_w-1))) >> _mulc_headroom_w;
+            if ( rr == 0 ) m_exp_class = EXP_CLASS::ZERO;
+            reconstruct( rr, m_exp_class, m_exp + plan->c_exp, m_sign ^ plan->c_sign );
+            if ( debug ) std::cout << "mulc: x=" << _to_flt(x) << " c=" << _to_flt(c) << " r=" << _to_flt(rr) << "\n";
+            if ( is_final ) rr = rfrac( rr );
+            return rr;
+        }
+    }
+    T r = mul( x, c, false );
+    if ( is_final ) r = rfrac( r );
+    return r;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::mulc( const T& x, const T& c ) const
 {
     return mulc( x, c, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqr( const T& x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqr( const T& x, bool is_final ) const
 {
     if ( is_final ) _log_1( sqr, x );
     T r = mul( x, x, false );
@@ -2901,57 +5467,61 @@ inline T Cordic<T,FLT>::sqr( const T& x, bool is_final ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqr( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqr( const T& x ) const
 {
+    _cr_1( sqr, x );
     return sqr( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fda( const T& _y, const T& _x, const T& addend ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fda( const T& _y, const T& _x, const T& addend ) const
 {
+    _cr_3( fda, _y, _x, addend );
     return fma_fda( false, _x, _y, addend, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::div( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div( const T& y, const T& x ) const
 {
+    _cr_2( div, y, x );
     return fda( y, x, _zero );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::div( const T& y, const T& x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::div( const T& y, const T& x, bool is_final ) const
 {
     return fma_fda( false, x, y, _zero, is_final );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::remainder( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::remainder( const T& y, const T& x ) const
 {
     return div( y, x );                 // FIXIT: placeholder
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::fmod( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::fmod( const T& y, const T& x ) const
 {
     return div( y, x );                 // FIXIT: placeholder
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::remquo( const T& y, const T& x, int * quo ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::remquo( const T& y, const T& x, int * quo ) const
 {
     return div( y, x );                 // FIXIT: placeholder
     *quo = 0;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rcp( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rcp( const T& x ) const
 {
+    _cr_1( rcp, x );
     return div( _one, x );
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::sqrt( const T& _x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::sqrt( const T& _x, bool is_final ) const
 { 
     //-----------------------------------------------------
     // Identities:
@@ -2987,7 +5557,7 @@ T Cordic<T,FLT>::sqrt( const T& _x, bool is_final ) const
         T xx, yy;
         hyperbolic_vectoring_xy( x+_one_fxd, x-_one_fxd, xx, yy );        // gain*sqrt((s+1)^2 - (s-1)^2)
         reconstruct( xx, x_exp_class, 0, x_sign );
-        x = mulc( xx, _hyperbolic_vectoring_one_over_gain, false );
+        x = mulc( xx, MULC::hyperbolic_vectoring_one_over_gain, false );
         do_rest = true;
     }
 
@@ -2999,31 +5569,78 @@ T Cordic<T,FLT>::sqrt( const T& _x, bool is_final ) const
         if ( is_final ) x = rfrac( x );
     }
 
-    if ( debug ) std::cout << "sqrt end: x_orig=" << _to_flt(_x, is_final) << " sqrt=" << _to_flt(x, is_final) << "\n";
-    return x;
-}
-
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sqrt( const T& x ) const
-{ 
-    return sqrt( x, true );
-}
+    if ( debug ) std::cout << "sqrt end: x_orig=" << _to_flt(_x, is_final) << " sqrt=" << _to_flt(x, is_final) << "\n";
+    return x;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sqrt( const T& x ) const
+{ 
+    _cr_1( sqrt, x );
+    return sqrt( x, true );
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rsqrt( const T& _x ) const
+{ 
+    _cr_1( rsqrt, _x );
+    //-----------------------------------------------------
+    // Identities:
+    //     1/sqrt(x) = 1/(2*sqrt(s)) * 2^-(log2(p)/2 - 1)      with x=p*s as in sqrt()
+    // Strategy:
+    //     hyperbolic_vectoring() gives q = gain*2*sqrt(s) just like sqrt(), and
+    //     then linear_vectoring() gives gain/q = 1/(2*sqrt(s)) directly from that,
+    //     so there is only one rounding at the end.
+    //-----------------------------------------------------
+    _log_1( rsqrt, _x );
+    T x = _x;
+    if ( debug ) std::cout << "rsqrt begin: x_orig=" << _to_flt(_x) << "\n";
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    reduce_sqrt_arg( x, x_exp_class, x_exp, x_sign );
+
+    // check for special cases
+    //
+    bool do_rest = false;
+    if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER || (x_sign && x_exp_class != EXP_CLASS::ZERO) ) {
+        // quiet NaN
+        x_exp_class = EXP_CLASS::NOT_A_NUMBER;
+        x |= _quiet_NaN_fxd;
+
+    } else if ( x_exp_class == EXP_CLASS::ZERO ) {
+        // +/-inf
+        x_exp_class = EXP_CLASS::INFINITE;
+
+    } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
+        // +0
+        x_exp_class = EXP_CLASS::ZERO;
+
+    } else {
+        T xx, yy, q;
+        hyperbolic_vectoring_xy( x+_one_fxd, x-_one_fxd, q, yy );        // gain*sqrt((s+1)^2 - (s-1)^2)
+        x_exp = -x_exp;
+        if ( _arith_backend == BACKEND::NATIVE ) {
+            if ( q < _one_fxd ) {
+                q <<= 1;
+                x_exp++;
+            }
+            x = div_fxd_nr( _hyperbolic_vectoring_gain_fxd, q );
+        } else {
+            linear_vectoring( q, _hyperbolic_vectoring_gain_fxd, _zero_fxd, xx, yy, x );
+        }
+        do_rest = true;
+    }
+
+    reconstruct( x, x_exp_class, x_exp, x_sign );
+    if ( do_rest ) x = rfrac( x );
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::rsqrt( const T& x ) const
-{ 
-    //-----------------------------------------------------
-    // 1.0 / sqrt( x )
-    //-----------------------------------------------------
-    _log_1( rsqrt, x );
-    T sq = sqrt( x, false );
-    T r = div( _one, sq );
-    if ( debug ) std::cout << "rsqrt end: x_orig=" << _to_flt(x) << " sqrt=" << _to_flt(sq) << " r=" << _to_flt(r, false) << "\n";
-    return r;
+    if ( debug ) std::cout << "rsqrt end: x_orig=" << _to_flt(_x) << " rsqrt=" << _to_flt(x) << "\n";
+    return x;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::rsqrt_orig( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rsqrt_orig( const T& x ) const
 { 
     //-----------------------------------------------------
     // x^(-1/2) = exp( log(x) / -2 );
@@ -3038,40 +5655,74 @@ T Cordic<T,FLT>::rsqrt_orig( const T& x ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cbrt( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::cbrt_rcbrt( bool is_rcbrt, const T& _x ) const
 { 
-    // x^(1/3) = exp( log(x) / 3 );
-    _log_1( cbrt, _x );
+    //-----------------------------------------------------
+    // Identities:
+    //     cbrt(-x)  = -cbrt(x)
+    //     cbrt(x)   = m * m^(-2/3) * 2^(j/3) * 2^k        where x = m * 2^(3k+j)
+    //     rcbrt(x)  = m^(-1/3) * 2^(j/3) * 2^k            where x = m * 2^-(3k+j)
+    // Strategy:
+    //     reduce_cbrt_arg() picks k and j in 0..2, and rcbrt_fxd() gets m^(-1/3)
+    //     with a few Newton-Raphson steps, all in fixed-point.
+    //-----------------------------------------------------
+    const char * kind = is_rcbrt ? "rcbrt" : "cbrt";
     T x = _x;
-    bool sign = signbit( x );
-    if ( sign ) x = neg( x, false );
-    T r = exp( mulc( log( x, false ), _third, false ) );
-    if ( sign ) r = neg( x, false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "cbrt end: x_orig=" << _to_flt(_x, false) << 
-                              " x_reduced=" << _to_flt(x, false, true, false) << " r=" << _to_flt(r, false) << "\n";
-    return r;
+    if ( debug ) std::cout << kind << " begin: x_orig=" << _to_flt(_x) << "\n";
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    T         scale;
+    reduce_cbrt_arg( is_rcbrt, x, x_exp_class, x_exp, x_sign, scale );
+
+    // check for special cases
+    //
+    bool do_rest = false;
+    if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // quiet NaN
+        x |= _quiet_NaN_fxd;
+
+    } else if ( x_exp_class == EXP_CLASS::ZERO ) {
+        // +/-0 or +/-inf
+        if ( is_rcbrt ) x_exp_class = EXP_CLASS::INFINITE;
+
+    } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
+        // +/-inf or +/-0
+        if ( is_rcbrt ) x_exp_class = EXP_CLASS::ZERO;
+
+    } else {
+        T u = rcbrt_fxd( x );
+        if ( !is_rcbrt ) u = mul_fxd( x, mul_fxd( u, u ) );
+        x = mul_fxd( u, scale );
+        do_rest = true;
+    }
+
+    reconstruct( x, x_exp_class, x_exp, x_sign );
+    if ( do_rest ) x = rfrac( x );
+
+    if ( debug ) std::cout << kind << " end: x_orig=" << _to_flt(_x) << " " << kind << "=" << _to_flt(x) << "\n";
+    return x;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::rcbrt( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cbrt( const T& x ) const
 { 
-    // x^(-1/3) = exp( log(x) / -3 );
-    _log_1( rcbrt, _x );
-    T x = _x;
-    bool sign = signbit( x );
-    if ( sign ) x = neg( x, false );
-    T r = exp( mulc( log( x, false ), _neg_third, false ) ); 
-    if ( sign ) r = neg( x, false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "rcbrt end: x_orig=" << _to_flt(_x, false) << 
-                              " x_reduced=" << _to_flt(x, false, true, false) << " r=" << _to_flt(r, false) << "\n";
-    return r;
+    _cr_1( cbrt, x );
+    _log_1( cbrt, x );
+    return cbrt_rcbrt( false, x );
 }
 
-template< typename T, typename FLT >
-inline int Cordic<T,FLT>::compare( const T& _x, const T& _y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rcbrt( const T& x ) const
+{
+    _cr_1( rcbrt, x );
+    _log_1( rcbrt, x );
+    return cbrt_rcbrt( true, x );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline int Cordic<T,FLT,CORE>::compare( const T& _x, const T& _y ) const
 {
     T         x = _x;
     T         y = _y;
@@ -3123,8 +5774,8 @@ inline int Cordic<T,FLT>::compare( const T& _x, const T& _y ) const
     }
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isgreater( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isgreater( const T& x, const T& y ) const
 {
     _log_2( isgreater, x, y );
     bool b = compare( x, y ) == 1;
@@ -3132,8 +5783,8 @@ inline bool Cordic<T,FLT>::isgreater( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isgreaterequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isgreaterequal( const T& x, const T& y ) const
 {
     _log_2( isgreaterequal, x, y );
     bool b = compare( x, y ) >= 0;
@@ -3141,8 +5792,8 @@ inline bool Cordic<T,FLT>::isgreaterequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isless( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isless( const T& x, const T& y ) const
 {
     _log_2( isless, x, y );
     bool b = compare( x, y ) == -1;
@@ -3150,8 +5801,8 @@ inline bool Cordic<T,FLT>::isless( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::islessequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::islessequal( const T& x, const T& y ) const
 {
     _log_2( islessequal, x, y );
     int cmp = compare( x, y );
@@ -3160,8 +5811,8 @@ inline bool Cordic<T,FLT>::islessequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::islessgreater( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::islessgreater( const T& x, const T& y ) const
 {
     _log_2( islessgreater, x, y );
     int cmp = compare( x, y );
@@ -3170,8 +5821,8 @@ inline bool Cordic<T,FLT>::islessgreater( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isunordered( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isunordered( const T& x, const T& y ) const
 {
     _log_2( isunordered, x, y );
     bool b = compare( x, y ) <= -2;   // either is a NaN
@@ -3179,8 +5830,8 @@ inline bool Cordic<T,FLT>::isunordered( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isunequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isunequal( const T& x, const T& y ) const
 {
     _log_2( isunequal, x, y );
     int cmp = compare( x, y );
@@ -3189,8 +5840,8 @@ inline bool Cordic<T,FLT>::isunequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-inline bool Cordic<T,FLT>::isequal( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isequal( const T& x, const T& y ) const
 {
     _log_2( isequal, x, y );
     int cmp = compare( x, y );
@@ -3199,32 +5850,32 @@ inline bool Cordic<T,FLT>::isequal( const T& x, const T& y ) const
     return b;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::fdim( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::fdim( const T& x, const T& y ) const
 { 
     _log_2( fdim, x, y );
     T r = isgreaterequal( x, y ) ? sub( x, y, true ) : _zero;
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::fmax( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::fmax( const T& x, const T& y ) const
 { 
     _log_2( fmax, x, y );
     T r = isgreaterequal( x, y ) ? x : y;
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::fmin( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::fmin( const T& x, const T& y ) const
 { 
     _log_2( fmin, x, y );
     T r = isless( x, y ) ? x : y;
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::exp( const T& _x, bool is_final, FLT b ) const
 { 
     //-----------------------------------------------------
     // Identities:
@@ -3248,8 +5899,8 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
 
     bool do_rest = false;
     if ( x_exp_class == EXP_CLASS::ZERO ) {
-        // one is the answer
-        x = _one;
+        // one is the answer, scaled by 2^i when the fraction part was exactly zero
+        x = scalbn( _one, i, false );
 
     } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
         // 0 or +inf
@@ -3260,8 +5911,7 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
         x = _x;
     
     } else {
-        T xx, yy, zz;
-        hyperbolic_rotation( _hyperbolic_rotation_one_over_gain_fxd, _hyperbolic_rotation_one_over_gain_fxd, x, xx, yy, zz );
+        T xx = exp_fxd( x );
         if ( debug ) std::cout << "exp mid: b=" << b << " x_orig=" << _to_flt(_x, is_final) << 
                                   " i=" << i << " exp(log(2)*f)=" << _to_flt(xx, false, true) << "\n";
         reconstruct( xx, x_exp_class, 0, false );
@@ -3273,54 +5923,241 @@ T Cordic<T,FLT>::exp( const T& _x, bool is_final, FLT b ) const
     return x;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::exp( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp( const T& x ) const
 { 
+    _cr_1( exp, x );
     return exp( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::expm1( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::expm1( const T& x ) const
 { 
+    _cr_1( expm1, x );
     //-----------------------------------------------------
     // Compute without rounding, then round.
     //-----------------------------------------------------
     return sub( exp( x, false ), one() );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::expc( const FLT& b, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::expc( const FLT& b, const T& x ) const
 { 
     return exp( x, true, b );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::exp2( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp2( const T& x ) const
 { 
+    _cr_1( exp2, x );
     return expc( 2.0, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::exp10( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::exp10( const T& x ) const
 { 
+    _cr_1( exp10, x );
     return expc( 10.0, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::pow( const T& b, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pow( const T& b, const T& x ) const
 { 
+    _cr_2( pow, b, x );
     if ( debug ) std::cout << "pow begin: b=" << _to_flt(b) << " x=" << _to_flt(x) << "\n";
     _log_2( pow, b, x );
-    T lg_b = log( b, false );
-    T m  = mul( x, lg_b, false );
-    T r = exp( m, false );
+    T r;
+    int n;
+    if ( isint( x, n ) ) {
+        // exact integer exponent (this also handles a negative b)
+        r = pown( b, n, false );
+    } else {
+        T lg_b = log( b, false );
+        T m  = mul( x, lg_b, false );
+        r = exp( m, false );
+    }
     r = rfrac( r );
     if ( debug ) std::cout << "pow end: b=" << _to_flt(b) << " x=" << _to_flt(x) << " pow=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log( const T& _x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::pown( const T& x, int n ) const
+{
+    _cr_1n( pown, x, n );
+    return pown( x, n, true );
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::pown( const T& _x, int n, bool is_final ) const
+{
+    //-----------------------------------------------------
+    // Identities:
+    //     pown(x, n)  = m^n * 2^(e*n)                  where x = m * 2^e
+    //     pown(x, -n) = 1 / pown(x, n)
+    //
+    // Strategy:
+    //     pown_fxd() does m^|n| by repeated squaring, then one divide if n < 0.
+    //     Nothing is rounded until the end.
+    //-----------------------------------------------------
+    if ( debug ) std::cout << "pown begin: x_orig=" << _to_flt(_x) << " n=" << n << "\n";
+    if ( is_final ) _log_2i( pown, _x, T(n) );
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    const bool r_sign = x_sign && (n & 1);
+
+    // check for special cases
+    //
+    if ( n == 0 ) {
+        // 1, even for NaN
+        x = _one;
+
+    } else if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // x is the answer
+        x = _x;
+
+    } else if ( x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::INFINITE ) {
+        // 0 or inf with the sign of x when n is odd
+        bool is_inf = (x_exp_class == EXP_CLASS::INFINITE) == (n > 0);
+        x = 0;
+        reconstruct( x, is_inf ? EXP_CLASS::INFINITE : EXP_CLASS::ZERO, 0, r_sign );
+
+    } else {
+        if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+            int32_t shift = clz( x ) - _one_fxd_clz;
+            x <<= shift;
+            x_exp -= shift;
+        }
+        int64_t e;
+        T r = pown_fxd( x, n, e );
+        e += int64_t(x_exp) * int64_t(n);
+        EXP_CLASS r_exp_class = EXP_CLASS::NORMAL;
+        if ( _is_float && e > int64_t(_exp_mask) - int64_t(_exp_bias) ) {         // reconstruct() rounds the rest to infinity
+            r_exp_class = EXP_CLASS::INFINITE;
+            e = 0;
+        } else if ( _is_float && e < -int64_t(_exp_bias) - int64_t(_frac_guard_w) - 2 ) {
+            r_exp_class = EXP_CLASS::ZERO;
+            e = 0;
+        }
+        reconstruct( r, r_exp_class, int32_t(e), r_sign );
+        x = r;
+        if ( is_final ) x = rfrac( x );
+    }
+
+    if ( debug ) std::cout << "pown end: x_orig=" << _to_flt(_x) << " n=" << n << " pown=" << _to_flt(x) << "\n";
+    return x;
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::rootn( const T& _x, int n ) const
+{
+    //-----------------------------------------------------
+    // Identities:
+    //     rootn(x, n)  = exp(log(|x|) / n)          with the sign of x for odd n
+    //
+    // Strategy:
+    //     n = +/-1, 2, and +/-3 have their own routines.  Otherwise, do it like pow(),
+    //     but multiply log(|x|) by 1/n, which is one fixed-point divide of the integer.
+    //-----------------------------------------------------
+    _cr_1n( rootn, _x, n );
+    if ( debug ) std::cout << "rootn begin: x_orig=" << _to_flt(_x) << " n=" << n << "\n";
+    _log_2i( rootn, _x, T(n) );
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    const bool r_sign = x_sign && (n & 1);
+
+    // check for special cases
+    //
+    T r;
+    if ( n == 0 || (x_sign && (n & 1) == 0 && x_exp_class != EXP_CLASS::ZERO && x_exp_class != EXP_CLASS::NOT_A_NUMBER) ) {
+        // NaN
+        r = quiet_NaN();
+
+    } else if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // x is the answer
+        r = _x;
+
+    } else if ( x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::INFINITE ) {
+        // 0 or inf with the sign of x when n is odd
+        bool is_inf = (x_exp_class == EXP_CLASS::INFINITE) == (n > 0);
+        r = 0;
+        reconstruct( r, is_inf ? EXP_CLASS::INFINITE : EXP_CLASS::ZERO, 0, r_sign );
+
+    } else if ( n == 1 ) {
+        r = _x;
+
+    } else if ( n == -1 ) {
+        r = rfrac( div( _one, _x, false ) );
+
+    } else if ( n == 2 ) {
+        r = rfrac( sqrt( _x, false ) );
+
+    } else if ( n == 3 || n == -3 ) {
+        r = cbrt_rcbrt( n < 0, _x );
+
+    } else {
+        // 1/n straight from the integer: n = nm * 2^(k-1) with 1 <= nm < 2
+        uint32_t n_abs = (n < 0) ? (uint32_t(0) - uint32_t(n)) : uint32_t(n);
+        int32_t  k     = 0;
+        while( (n_abs >> k) != 0 ) k++;
+        const int32_t fg = _frac_guard_w;
+        T nm = (fg >= k-1) ? (T(n_abs) << (fg-k+1)) : (T(n_abs) >> (k-1-fg));
+        int32_t rn_exp = 0;
+        T rn = (nm == _one_fxd) ? _one_fxd : ratio_fxd( _one_fxd, nm, rn_exp );  // keep 1/2^j exact
+
+        // log(|x|) * 1/n in fixed-point
+        T ax = x_sign ? neg( _x, false ) : _x;
+        T lg = log( ax, false );
+        EXP_CLASS lg_exp_class;
+        int32_t   lg_exp;
+        bool      lg_sign;
+        deconstruct( lg, lg_exp_class, lg_exp, lg_sign );
+        if ( lg_exp_class == EXP_CLASS::NORMAL || lg_exp_class == EXP_CLASS::SUBNORMAL ) {
+            lg = mul_fxd( lg, rn );
+            lg_exp += rn_exp - (k-1);
+            lg_sign ^= n < 0;
+        }
+        reconstruct( lg, lg_exp_class, lg_exp, lg_sign );
+        r = exp( lg, false );
+        if ( r_sign ) r = neg( r, false );
+        r = rfrac( r );
+    }
+
+    if ( debug ) std::cout << "rootn end: x_orig=" << _to_flt(_x) << " n=" << n << " rootn=" << _to_flt(r) << "\n";
+    return r;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::isint( const T& _x, int& n ) const
+{
+    //-----------------------------------------------------
+    // True if x is zero or an integer with |x| < 2^31.
+    //-----------------------------------------------------
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign, false );
+    if ( x_exp_class == EXP_CLASS::ZERO ) {
+        n = 0;
+        return true;
+    }
+    if ( x_exp_class != EXP_CLASS::NORMAL || x_exp < 0 || x_exp > 30 ) return false;
+    int32_t frac_bits = int32_t(_frac_guard_w) - x_exp;
+    if ( frac_bits > 0 && (x & ((T(1) << frac_bits) - 1)) != 0 ) return false;
+    T i = (frac_bits >= 0) ? (x >> frac_bits) : (x << -frac_bits);
+    n = x_sign ? -int(i) : int(i);
+    return true;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log( const T& _x, bool is_final ) const
 { 
     //-----------------------------------------------------
     // log(x) = 2*atanh2(x-1, x+1);
@@ -3331,7 +6168,7 @@ inline T Cordic<T,FLT>::log( const T& _x, bool is_final ) const
     EXP_CLASS x_exp_class;
     bool x_sign;
     T addend;
-    reduce_log_arg( x, x_exp_class, x_sign, addend );                        // does not deconstruct value
+    reduce_log_arg( x, x_exp_class, x_sign, addend );                        // leaves 1 <= x < 2 in fixed-point
     T r;
     if ( x_exp_class == EXP_CLASS::ZERO ) {
         // -inf
@@ -3353,42 +6190,85 @@ inline T Cordic<T,FLT>::log( const T& _x, bool is_final ) const
         r = _x;
         if ( debug ) std::cout << "log end: x_orig=" << _to_flt(_x) << " log=inf" << "\n";
 
+    } else if ( _x == _one ) {
+        // exactly 0, where log(1/2) + log(2) would only cancel to within an lsb
+        r = _zero;
+
     } else {
-        T x_m1 = sub( x, _one, false );
-        T x_p1 = add( x, _one, false );
-        T dv   = div( x_m1, x_p1, false );
-        T lg1  = atanh2( dv, _one, false, true );
-        T lg2  = scalbn( lg1, 1, false );
-          r    = add( lg2, addend, false );
+        // x = m with 1 <= m < 2, and we want log(m/2)
+        T lg2 = log_fxd( x );
+        bool lg2_sign = lg2 < 0;
+        if ( lg2_sign ) lg2 = -lg2;
+        reconstruct( lg2, (lg2 == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, lg2_sign );
+        r = add( lg2, addend, false );
         if ( is_final ) r = rfrac( r );
-        if ( debug ) std::cout << "log end: x_orig=" << _to_flt(_x) << " x_m1=" << _to_flt(x_m1) << " x_p1=" << _to_flt(x_p1) <<
-                                          " dv=" << _to_flt(dv) << " lg1=" << _to_flt(lg1) << " lg2=" << _to_flt(lg2) << " addend=" << _to_flt(addend) <<
-                                          " log=" << _to_flt(r) << "\n";
+        if ( debug ) std::cout << "log end: x_orig=" << _to_flt(_x) << " m=" << _to_flt(x, false, true) << " lg2=" << _to_flt(lg2) <<
+                                          " addend=" << _to_flt(addend) << " log=" << _to_flt(r) << "\n";
     }
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log( const T& _x ) const
 { 
+    _cr_1( log, _x );
     return log( _x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log1p( const T& _x, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log1p( const T& _x, bool is_final ) const
 { 
-    return log( add( _x, _one, is_final ), is_final );   
+    //-----------------------------------------------------
+    // log1p(x) = 2*atanh(u) with u = x/(2+x)
+    //
+    // For |x| < 1/2 and for 1/2 <= x < 1, |u| <= 1/3 and atanh_fxd() sums the series.
+    // ratio_fxd() gives u with its own exponent, so the result keeps x's relative precision
+    // all the way down, where a vectoring pass would leave an absolute error.  Otherwise,
+    // use log(1+x) with 1+x kept to the guard bits.
+    //-----------------------------------------------------
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    if ( x_exp_class == EXP_CLASS::INFINITE || (x_exp_class != EXP_CLASS::ZERO && x_exp_class != EXP_CLASS::NOT_A_NUMBER &&
+                                                 (x_exp >= 0 || (x_exp == -1 && x_sign))) ) {
+        return log( add( _x, _one, false ), is_final );
+    }
+
+    if ( is_final ) _log_1( log1p, _x );
+    T r;
+    if ( x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::NOT_A_NUMBER ||
+         x_exp_class == EXP_CLASS::SUBNORMAL || x_exp < -int32_t(_frac_guard_w) ) {
+        // x is the answer (x^2/2 is below the guard bits)
+        r = _x;
+
+    } else {
+        int32_t shift = std::min( 1 - x_exp, int32_t(_frac_guard_w) + 1 );  // x/2 in fixed-point
+        T h = (x >> shift) | T((x & ((T(1) << shift) - 1)) != 0);
+        if ( x_sign ) h = -h;
+        int32_t u_exp;
+        T u = ratio_fxd( x, _one_fxd + h, u_exp );                          // |u| = u * 2^u_exp
+        u_exp += x_exp - 1;
+        r = atanh_fxd( u, u_exp );
+        reconstruct( r, EXP_CLASS::NORMAL, u_exp + 1, x_sign );
+        if ( is_final ) r = rfrac( r );
+    }
+    if ( debug ) std::cout << "log1p end: x_orig=" << _to_flt(_x) << " log1p=" << _to_flt(r) << "\n";
+    return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log1p( const T& _x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log1p( const T& _x ) const
 { 
+    _cr_1( log1p, _x );
     return log1p( _x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log( const T& x, const T& b ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log( const T& x, const T& b ) const
 { 
+    _cr_2( log, x, b );
     _log_2( logn, x, b );
     T lgx = log( x, false );
     T lgb = log( b, false );
@@ -3398,55 +6278,128 @@ inline T Cordic<T,FLT>::log( const T& x, const T& b ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::logc( const T& x, const FLT& b ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::logc( const T& x, const FLT& b ) const
 { 
     _log_2f( logc, x, b );
-    const FLT  one_over_log_b_f = FLT(1) / std::log( b );
-    const T    one_over_log_b   = to_t( one_over_log_b_f );
-          T    log_x            = log( x, false );
-    T r = mulc( log_x, one_over_log_b, false );
+    if ( b == FLT(2) ) return log2( x, true );
+    T log_x = log( x, false );
+    BASE_CONSTS scratch;
+    const BASE_CONSTS& bc = base_consts( b, scratch );
+    T r = mulc( log_x, bc.one_div_log_b, bc.one_div_log_b_plan, false );
     r = rfrac( r );
     if ( debug ) std::cout << "logc: b=" << _to_flt(b) << " x=" << _to_flt(x) << " reduced_x=" << _to_flt(x, false, true) << " log=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log2( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log2( const T& x ) const
 { 
-    return logc( x, 2.0 );
+    _cr_1( log2, x );
+    _log_1( log2, x );
+    return log2( x, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::log10( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::log2( const T& _x, bool is_final ) const
+{
+    //-----------------------------------------------------
+    // log2(m * 2^e) = e + log2(m) = e + 2*atanh((m-1)/(m+1))/log(2)
+    //
+    // The integer part is just the exponent, so there is one hyperbolic pass
+    // and a fixed-point multiply by 1/log(2).  Fixed-point x is deconstructed the same way.
+    //
+    // For 1/2 <= x < 3/2, log(x) = 2*atanh(d/(2+d)) with d = x-1, which is exact in fixed-point,
+    // and atanh_fxd() keeps d's relative precision, so the result doesn't cancel against e.
+    //-----------------------------------------------------
+    if ( debug ) std::cout << "log2 begin: x_orig=" << _to_flt(_x) << " is_final=" << is_final << "\n";
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    T r;
+    if ( x_exp_class == EXP_CLASS::ZERO ) {
+        // -inf
+        r = ninfinity();
+
+    } else if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // _x is the answer
+        r = _x;
+
+    } else if ( x_sign ) {
+        // < 0 => NaN
+        r = quiet_NaN();
+
+    } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
+        // x is already infinity
+        r = _x;
+
+    } else {
+        if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+            int32_t shift = clz( x ) - _one_fxd_clz;
+            x <<= shift;
+            x_exp -= shift;
+        }
+        T lg;
+        if ( x == _one_fxd ) {
+            r = T(x_exp) << _frac_guard_w;                                // exact for powers of 2
+            bool r_sign = r < 0;
+            if ( r_sign ) r = -r;
+            reconstruct( r, (r == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, r_sign );
+        } else if ( x_exp == -1 || (x_exp == 0 && x < (_one_fxd + _half_fxd)) ) {
+            // |u| = |d|/(2+d) <= 1/3, where d = x-1 or (x-2)/2
+            int32_t u_exp;
+            T u = (x_exp == 0) ? ratio_fxd( x - _one_fxd, x + _one_fxd, u_exp )
+                               : ratio_fxd( _two_fxd - x, _two_fxd + x, u_exp );
+            r = mul_fxd( atanh_fxd( u, u_exp ), _one_div_log2_fxd );
+            reconstruct( r, EXP_CLASS::NORMAL, u_exp + 1, x_exp == -1 );
+        } else {
+            T xx, yy;
+            hyperbolic_vectoring( (x + _one_fxd) >> 1, (x - _one_fxd) >> 1, _zero_fxd, xx, yy, lg );  // halved to stay < 2
+            lg <<= 1;
+            r = (T(x_exp) << _frac_guard_w) + mul_fxd( lg, _one_div_log2_fxd );
+            bool r_sign = r < 0;
+            if ( r_sign ) r = -r;
+            reconstruct( r, (r == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, r_sign );
+        }
+        if ( is_final ) r = rfrac( r );
+    }
+    if ( debug ) std::cout << "log2 end: x_orig=" << _to_flt(_x) << " log2=" << _to_flt(r) << "\n";
+    return r;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::log10( const T& x ) const
 { 
+    _cr_1( log10, x );
     return logc( x, 10.0 );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::deg2rad( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::deg2rad( const T& x ) const
 {
+    _cr_1( deg2rad, x );
     _log_1( deg2rad, x );
-    T _180 = to_t( FLT(180) );
-    T r = mulc( x, _180, false );
-      r = mulc( r, _one_div_pi, false );
+    T r = mulc( x, MULC::deg_per_pi, false );
+      r = mulc( r, MULC::one_div_pi, false );
       r = rfrac( r );
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::rad2deg( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::rad2deg( const T& x ) const
 {
+    _cr_1( rad2deg, x );
     _log_1( rad2deg, x );
-    T ONE_DIV_180 = to_t( FLT(1) / FLT(180) );
-    T r = mulc( x, _pi, false );
-      r = mulc( r, ONE_DIV_180, false );
+    T r = mulc( x, MULC::pi, false );
+      r = mulc( r, MULC::pi_per_deg, false );
       r = rfrac( r );
     return r;
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_final, bool need_si, bool need_co, const T * _r ) const             
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_final, bool need_si, bool need_co, const T * _r ) const             
 { 
     if ( is_final ) {
         if ( _r != nullptr ) {
@@ -3477,13 +6430,33 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
     bool did_minus_pi_div_4;
     reduce_sincos_arg( times_pi, x, quadrant, x_exp_class, x_sign, did_minus_pi_div_4 );
 
+    //-----------------------------------------------------
+    // A normal r is folded into the starting vector of the rotation (as r/2 to stay
+    // in range) and its exponent is applied by reconstruct().  Otherwise, multiply at the end.
+    //-----------------------------------------------------
+    T         r;
+    EXP_CLASS r_exp_class;
+    int32_t   r_exp;
+    bool      r_sign;
+    reduce_r_arg( _r, r, r_exp_class, r_exp, r_sign );
+    bool fold_r = r_exp_class == EXP_CLASS::NORMAL;
+    if ( !fold_r ) {
+        r      = _one_fxd;
+        r_exp  = 0;
+        r_sign = false;
+    }
+
     // check for special cases
     //
     if ( x_exp_class == EXP_CLASS::ZERO ) {
         // si = 0
         // co = 1
         if ( need_si ) si = _x;
-        if ( need_co ) co = signbit(_x) ? _neg_one : _one;
+        if ( need_co ) co = _one;
+        if ( _r != nullptr ) {
+            if ( need_si ) si = mul( si, *_r, false );
+            if ( need_co ) co = mul( co, *_r, false );
+        }
 
     } else if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER || x_exp_class == EXP_CLASS::INFINITE ) {
         // NaN
@@ -3494,58 +6467,85 @@ void Cordic<T,FLT>::sincos( bool times_pi, const T& _x, T& si, T& co, bool is_fi
         if ( need_co ) co = x;
 
     } else {
-        T zz;
-        circular_rotation( _circular_rotation_one_over_gain_fxd, _zero, x, co, si, zz );
-
-        if ( si < 0 ) si = 0;                   // FIXIT: temporary hack when x is tiny
-        if ( co < 0 ) co = 0;
-        reconstruct( si, (si == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, false );
-        reconstruct( co, (co == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, false );
-
-        //-----------------------------------------------------
-        // If did_minus_pi_div_4 is true, then we need to perform this
-        // modification for sin and cos:
-        //
-        // sin(x+PI/4) = sqrt(2)/2 * ( sin(x) + cos(x) )
-        // cos(x+PI/4) = sqrt(2)/2 * ( cos(x) - sin(x) )
-        //-----------------------------------------------------
-        if ( did_minus_pi_div_4 ) {
-            T si_new = mulc( add( si, co, false ), _sqrt2_div_2, false );
-            T co_new = mulc( sub( co, si, false ), _sqrt2_div_2, false );
-            si = si_new;
-            co = co_new;
+        if ( x == 0 ) {
+            // sinpi() or cospi() of a multiple of 1/2: exact, where a rotation by 0 would leave a residue
+            co = r;
+            si = 0;
+        } else if ( _sincos_lut_w != 0 || _fn_backend[uint32_t(FN_KERNEL::SINCOS)] != FN_BACKEND::CORDIC ) {
+            sincos_fxd( x, co, si );
+            if ( r != _one_fxd ) {
+                co = mul_fxd( co, r );
+                si = mul_fxd( si, r );
+            }
+        } else {
+            T x0 = _circular_rotation_one_over_gain_fxd;
+            if ( r != _one_fxd ) {
+                x0 = mul_fxd( x0, r >> 1 );
+                r_exp++;
+            }
+            T zz;
+            circular_rotation( x0, _zero, x, co, si, zz );
         }
+        sincos_finish( si, co, quadrant, x_sign, did_minus_pi_div_4, is_final, need_si, need_co, r_exp, r_sign, fold_r ? nullptr : _r );
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos_finish( T& si, T& co, uint32_t quadrant, bool x_sign, bool did_minus_pi_div_4, 
+                                   bool is_final, bool need_si, bool need_co, int32_t r_exp, bool r_sign, const T * _r ) const
+{ 
+    //-----------------------------------------------------
+    // si and co are the reduced circular_rotation() results, already multiplied by
+    // r's mantissa if r was folded in, and r_exp and r_sign are the rest of that r.
+    // Otherwise, _r is multiplied in at the end.
+    //-----------------------------------------------------
+    if ( si < 0 ) si = 0;                   // FIXIT: temporary hack when x is tiny
+    if ( co < 0 ) co = 0;
+    reconstruct( si, (si == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp, r_sign );
+    reconstruct( co, (co == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp, r_sign );
 
-        //-----------------------------------------------------
-        // Next, make adjustments for the quadrant.
-        //-----------------------------------------------------
-        if ( quadrant&1 ) {
-            T tmp = co;
-            co = si;
-            si = tmp;
-        }
-        if ( need_si && (x_sign ^ (quadrant >= 2)) )                  si = neg( si, false );
-        if ( need_co && (         (quadrant == 1) || quadrant == 2) ) co = neg( co, false );
+    //-----------------------------------------------------
+    // If did_minus_pi_div_4 is true, then we need to perform this
+    // modification for sin and cos:
+    //
+    // sin(x+PI/4) = sqrt(2)/2 * ( sin(x) + cos(x) )
+    // cos(x+PI/4) = sqrt(2)/2 * ( cos(x) - sin(x) )
+    //-----------------------------------------------------
+    if ( did_minus_pi_div_4 ) {
+        T si_new = mulc( add( si, co, false ), MULC::sqrt2_div_2, false );
+        T co_new = mulc( sub( co, si, false ), MULC::sqrt2_div_2, false );
+        si = si_new;
+        co = co_new;
+    }
 
-        if ( _r != nullptr ) {
-            //-----------------------------------------------------
-            // Keep it simple for now.
-            // Don't attempt to include r in the circular_rotation().
-            //-----------------------------------------------------
-            if ( need_si ) si = mul( si, *_r, false );
-            if ( need_co ) co = mul( co, *_r, false );
-        }
+    //-----------------------------------------------------
+    // Next, make adjustments for the quadrant.
+    //-----------------------------------------------------
+    if ( quadrant&1 ) {
+        T tmp = co;
+        co = si;
+        si = tmp;
+    }
+    if ( need_si && (x_sign ^ (quadrant >= 2)) )                  si = neg( si, false );
+    if ( need_co && (         (quadrant == 1) || quadrant == 2) ) co = neg( co, false );
 
-        if ( is_final ) {
-            if ( need_si ) si = rfrac( si );
-            if ( need_co ) co = rfrac( co );
-        }
+    if ( _r != nullptr ) {
+        if ( need_si ) si = mul( si, *_r, false );
+        if ( need_co ) co = mul( co, *_r, false );
+    }
+
+    if ( is_final ) {
+        if ( need_si ) si = rfrac( si );
+        if ( need_co ) co = rfrac( co );
     }
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sin( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sin( const T& x, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1( sin, x );
+    }
     if ( r != nullptr ) {
         _log_2( sin, x, *r );
     } else {
@@ -3559,9 +6559,12 @@ inline T Cordic<T,FLT>::sin( const T& x, const T * r ) const
     return si;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cos( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cos( const T& x, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1( cos, x );
+    }
     if ( r != nullptr ) {
         _log_2( cos, x, *r );
     } else {
@@ -3575,29 +6578,94 @@ inline T Cordic<T,FLT>::cos( const T& x, const T * r ) const
     return co;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::sincos( const T& x, T& si, T& co, const T * r ) const             
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sincos( const T& x, T& si, T& co, const T * r ) const             
 {
+    if ( r == nullptr ) {
+        _cr_1_2( sincos, x, si, co );
+    }
     sincos( false, x, si, co, true, true, true, r );
     if ( debug ) std::cout << "sincos end: x_orig=" << _to_flt(x) << " sin=" << _to_flt(si) << " cos=" << _to_flt(co) << 
                               " r=" << ((r != nullptr) ? _to_flt(*r) : 1.0) << "\n";
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::tan( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::tan( const T& x ) const
 { 
+    _cr_1c( tan, x, _cr_tan_w );
     _log_1( tan, x );
-    T si, co;
-    sincos( false, x, si, co, false, true, true, nullptr );
-    T r = div( si, co, false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "tan end: x_orig=" << _to_flt(x) << " tan=" << _to_flt(r) << "\n";
+    return tan( false, x );
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::tan( bool times_pi, const T& _x ) const
+{
+    //-----------------------------------------------------
+    // Identities:
+    //     tan(-x)      = -tan(x)
+    //     tan(x+PI/4)  = (sin(x) + cos(x)) / (cos(x) - sin(x))
+    //     tan(x+PI/2)  = -cos(x) / sin(x)
+    // Strategy:
+    //     Reduce x like sincos() does and rotate to get (cos, sin) in fixed-point.
+    //     Only their ratio matters, so the sqrt(2)/2 for +PI/4 is not needed.
+    //     Then divide them while still in fixed-point with ratio_fxd().
+    //-----------------------------------------------------
+    const char * kind = times_pi ? "tanpi" : "tan";
+    T x = _x;
+    uint32_t  quadrant;
+    EXP_CLASS x_exp_class;
+    bool      x_sign;
+    bool      did_minus_pi_div_4;
+    reduce_sincos_arg( times_pi, x, quadrant, x_exp_class, x_sign, did_minus_pi_div_4 );
+
+    // check for special cases
+    //
+    T r;
+    if ( x_exp_class == EXP_CLASS::ZERO ) {
+        // x is the answer
+        r = _x;
+
+    } else if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER || x_exp_class == EXP_CLASS::INFINITE ) {
+        // NaN
+        r = x | _quiet_NaN_fxd;
+        reconstruct( r, EXP_CLASS::NOT_A_NUMBER, 0, x_sign );
+
+    } else {
+        T co, si;
+        sincos_fxd( x, co, si );
+        if ( si < 0 ) si = 0;
+        if ( co < 0 ) co = 0;
+        if ( did_minus_pi_div_4 ) {
+            T si_new = si + co;
+            T co_new = co - si;
+            si = si_new;
+            co = (co_new < 0) ? T(0) : co_new;
+        }
+        if ( quadrant & 1 ) std::swap( si, co );
+        bool sign = x_sign ^ (quadrant & 1);
+        int32_t r_exp = 0;
+        if ( si == 0 ) {
+            r = 0;
+            reconstruct( r, EXP_CLASS::ZERO, 0, sign );
+        } else if ( co == 0 ) {
+            r = sign ? ninfinity() : infinity();
+        } else {
+            r = ratio_fxd( si, co, r_exp );
+            reconstruct( r, EXP_CLASS::NORMAL, r_exp, sign );
+            r = rfrac( r );
+        }
+    }
+
+    if ( debug ) std::cout << kind << " end: x_orig=" << _to_flt(_x) << " " << kind << "=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sinpi( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sinpi( const T& x, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1( sinpi, x );
+    }
     if ( r != nullptr ) {
         _log_2( sinpi, x, *r );
     } else {
@@ -3611,9 +6679,12 @@ inline T Cordic<T,FLT>::sinpi( const T& x, const T * r ) const
     return si;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cospi( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cospi( const T& x, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1( cospi, x );
+    }
     if ( r != nullptr ) {
         _log_2( cospi, x, *r );
     } else {
@@ -3627,180 +6698,249 @@ inline T Cordic<T,FLT>::cospi( const T& x, const T * r ) const
     return co;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::sinpicospi( const T& x, T& si, T& co, const T * r ) const             
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinpicospi( const T& x, T& si, T& co, const T * r ) const             
 {
+    if ( r == nullptr ) {
+        _cr_1_2( sinpicospi, x, si, co );
+    }
     sincos( true, x, si, co, true, true, true, r );
     if ( debug ) std::cout << "sinpicospi end: x_orig=" << _to_flt(x) << " sinpi=" << _to_flt(si) << " cospi=" << _to_flt(co) << 
                               " r=" << ((r != nullptr) ? _to_flt(*r) : 1.0) << "\n";
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::tanpi( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::tanpi( const T& x ) const
 { 
-    _log_1( tan, x );
-    T si, co;
-    sincos( true, x, si, co, false, true, true, nullptr );
-    T r = div( si, co, false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "tanpi end: x_orig=" << _to_flt(x) << " tanpi=" << _to_flt(r) << "\n";
-    return r;
+    _cr_1c( tanpi, x, _cr_tan_w );
+    _log_1( tanpi, x );
+    return tan( true, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::asin( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::asin( const T& x ) const
 { 
+    _cr_1( asin, x );
     _log_1( asin, x );
-    T nh = hypoth( _one, x, false );
-    T r = atan2( x, nh, false, false, nullptr );
-    r = rfrac( r );
-    if ( debug ) std::cout << "asin end: x_orig=" << _to_flt(x) << " asin=" << _to_flt(r) << "\n";
-    return r;
+    return asin_acos( false, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::acos( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::acos( const T& x ) const
 { 
+    _cr_1( acos, x );
     _log_1( acos, x );
-    T nh = hypoth( _one, x, false );
-    T r = atan2( nh, x, false, false, nullptr );
-    r = rfrac( r );
-    if ( debug ) std::cout << "acos end: x_orig=" << _to_flt(x) << " acos=" << _to_flt(r) << "\n";
+    return asin_acos( true, x );
+}
+
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::asin_acos( bool is_acos, const T& _x ) const
+{
+    //-----------------------------------------------------
+    // Identities:
+    //     asin(-x) = -asin(x)
+    //     acos(-x) = PI - acos(x)
+    //     acos(x)  = PI/2 - asin(x)
+    //     asin(x)  = PI/2 - 2*asin(sqrt((1-x)/2))
+    //     acos(x)  = 2*asin(sqrt((1-x)/2))
+    // Strategy:
+    //     For |x| <= 1/2, asin_fxd() gets asin(|x|) in one pass.
+    //     Above that, asin's slope makes any fixed-point error in x blow up, so use
+    //     asin_fxd() of sqrt((1-|x|)/2) instead, where 1-|x| is exact and sqrt_fxd()
+    //     keeps its relative precision.
+    //     Small asin results keep their exponent so that asin(x) near 0 and acos(x) near 1
+    //     are not limited by the fixed-point angle.
+    //-----------------------------------------------------
+    const char * kind = is_acos ? "acos" : "asin";
+    if ( debug ) std::cout << kind << " begin: x_orig=" << _to_flt(_x) << "\n";
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+
+    // check for special cases
+    //
+    T r;
+    bool is_one = x_exp_class == EXP_CLASS::NORMAL && x_exp == 0 && x == _one_fxd;
+    if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // x is the answer
+        r = _x;
+
+    } else if ( x_exp_class == EXP_CLASS::INFINITE || (x_exp_class == EXP_CLASS::NORMAL && x_exp >= 0 && !is_one) ) {
+        // |x| > 1 => NaN
+        r = quiet_NaN();
+
+    } else if ( !is_acos && (x_exp_class == EXP_CLASS::ZERO || 2*x_exp < -int32_t(_frac_guard_w)) ) {
+        // x^3/6 is below the guard bits
+        r = _x;
+
+    } else {
+        const T pi_div_2 = _pi_fxd >> 1;
+        T       a;
+        int32_t a_exp;
+        bool    is_big = x_exp_class == EXP_CLASS::NORMAL && (x_exp == -1 || is_one);
+        if ( !is_big ) {
+            // |x| < 1/2
+            if ( x_exp_class == EXP_CLASS::ZERO ) {
+                a = 0;
+                a_exp = 0;
+            } else {
+                if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+                    int32_t shift = clz( x ) - _one_fxd_clz;
+                    x <<= shift;
+                    x_exp -= shift;
+                }
+                a_exp = x_exp;
+                a = asin_fxd( x, a_exp );
+            }
+            if ( is_acos ) {
+                a = pi_div_2 - (a >> std::min( -a_exp, int32_t(_frac_guard_w) + 1 ));
+                a_exp = 0;
+            }
+        } else {
+            // 1/2 <= |x| <= 1, u = 2*(1-|x|) is exact
+            T u = is_one ? T(0) : (_two_fxd - x);
+            if ( u == 0 ) {
+                a = 0;
+                a_exp = 0;
+            } else {
+                a = sqrt_fxd( u, a_exp );                       // sqrt((1-|x|)/2) = sqrt(u)/2
+                a_exp--;
+                a = asin_fxd( a, a_exp );
+                a_exp++;
+            }
+            if ( !is_acos ) {
+                a = pi_div_2 - (a_exp >= 0 ? (a << a_exp) : (a >> std::min( -a_exp, int32_t(_frac_guard_w) + 1 )));
+                a_exp = 0;
+            }
+        }
+        bool a_sign = x_sign;
+        if ( is_acos ) {
+            if ( x_sign ) {
+                a = _pi_fxd - (a_exp >= 0 ? (a << a_exp) : (a >> std::min( -a_exp, int32_t(_frac_guard_w) + 1 )));
+                a_exp = 0;
+            }
+            a_sign = false;
+        }
+        if ( a < 0 ) a = 0;
+        reconstruct( a, (a == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, a_exp, a_sign );
+        r = rfrac( a );
+    }
+
+    if ( debug ) std::cout << kind << " end: x_orig=" << _to_flt(_x) << " " << kind << "=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atan( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atan( const T& x ) const
 { 
+    _cr_1( atan, x );
     T r = atan2( x, _one, true, true, nullptr );
     if ( debug ) std::cout << "atan end: x_orig=" << _to_flt(x) << " atan=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atan2( const T& y, const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atan2( const T& y, const T& x ) const
 { 
+    _cr_2( atan2, y, x );
     T r = atan2( y, x, true, false, nullptr );
     if ( debug ) std::cout << "atan2 end: y=" << _to_flt(y) << " x=" << _to_flt(x) << " atan2=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one, T * r ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::atan2( const T& _y, const T& _x, bool is_final, bool x_is_one, T * r ) const
 { 
     if ( is_final ) _log_2( atan2, _y, _x );
-    T y = _y;
-    T x = _x;
+    (void)x_is_one;
 
     //-----------------------------------------------------
     // Identities:
     //     atan2(y,x)       = undefined                             if x == 0 && y == 0
-    //     atan2(y,x)       = PI                                    if x <  0 && y == 0
-    //     atan2(y,x)       = 2*atan(y / (sqrt(x^2 + y^2) + x))     if x >  0    
-    //     atan2(y,x)       = 2*atan((sqrt(x^2 + y^2) - |x|) / y)   if x <= 0 && y != 0
+    //     atan2(y,x)       = atan(|y|/|x|)                         if |y| <= |x|
+    //     atan2(y,x)       = PI/2 - atan(|x|/|y|)                  if |y| >  |x|
+    //     atan2(y,x)       = PI - atan2(y,|x|)                     if x < 0
+    //     atan2(y,x)       = -atan2(|y|,x)                         if y < 0
     // Strategy:
-    //     Look at signs and values.
-    //     Return PI if we're done.
-    //     Do 2*atan( y / (hypot(x, y) + x) )    if x > 0
-    //     Do 2*atan( (hypot(x, y) - x) / y )    if x <= 0
-    //     When using cordic atan2 for the latter, if the numerator is larger than
-    //     the denominator, then use PI - atan(x/y)
-    //-----------------------------------------------------
-    if ( debug ) std::cout << "atan2 begin: y=" << _to_flt(y, is_final) << 
-                                          " x=" << _to_flt(x, is_final) << 
+    //     Scale |x| and |y| by the same power-of-2 and swap them so that |y| <= |x|.
+    //     One circular_vectoring() then leaves atan(|y|/|x|) in z and gain*sqrt(x^2 + y^2) in x,
+    //     so r costs only the 1/gain multiply.
+    //     Fix up the octant in fixed-point, then reconstruct.
+    //-----------------------------------------------------
+    if ( debug ) std::cout << "atan2 begin: y=" << _to_flt(_y, is_final) << 
+                                          " x=" << _to_flt(_x, is_final) << 
                                           " x_is_one=" << x_is_one << "\n";
-    if ( r != nullptr ) *r = hypot( _x, _y, false );  // FIXIT: optimize this later 
-
-    bool      x_sign = signbit( x );
-    bool      y_sign = signbit( y );
-    EXP_CLASS x_exp_class = classify( x );
-    EXP_CLASS y_exp_class = classify( y );
-    bool      x_gt_0 = !x_sign && x_exp_class != EXP_CLASS::ZERO;
+    bool      x_sign = signbit( _x );
+    bool      y_sign = signbit( _y );
+    EXP_CLASS x_exp_class = classify( _x );
+    EXP_CLASS y_exp_class = classify( _y );
     
     // check for special cases
+    T rr;
+    bool swapped = false;
     if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
         // x is the answer 
-        return _x;
+        rr = _x;
 
     } else if ( y_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
         // y is the answer
+        rr = _y;
 
     } else if ( (x_exp_class == EXP_CLASS::ZERO     && y_exp_class == EXP_CLASS::ZERO) ||
                 (x_exp_class == EXP_CLASS::INFINITE && y_exp_class == EXP_CLASS::INFINITE) ) {
         // NaN
-        return quiet_NaN();
-
-    } else if ( x_sign && y_exp_class == EXP_CLASS::ZERO ) {
-        // PI
-        return _pi;
-
-    } else if ( (x_gt_0  && x_exp_class == EXP_CLASS::INFINITE) ||
-                (!x_gt_0 && y_exp_class == EXP_CLASS::INFINITE) ) {
-        // atan(0) == 0
-        return (x_sign ^ y_sign) ? _neg_zero : _zero;
-    }
-
-    // normal case
-    //
-    T hpx = hypot( x, y, false );
-      hpx = add( hpx, x_gt_0 ? x : neg( x, false ), false );
-    if ( debug ) std::cout << "atan2 mid: y=" << _to_flt(_y) << " x=" << _to_flt(_x) << " hpx=" << _to_flt(hpx) << "\n";
-
-    // decide which is the numerator and which is the denominator
-    //
-    if ( x_gt_0 ) {
-        x = hpx;
-    } else {
-        x = y;
-        y = hpx;
-    }
+        rr = quiet_NaN();
 
-    bool      rr_sign = signbit(x) ^ signbit(y);
-    EXP_CLASS exp_class;
-    int32_t   exp;
-    bool      swapped;
-    reduce_hypot_args( x, y, exp_class, exp, swapped );
+    } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
+        // 0 or PI
+        rr = x_sign ? _pi : _zero;
+        if ( y_sign ) rr = neg( rr, false );
 
-    // check for special cases
-    T rr;
-    bool did_neg = false;
-    if ( exp_class == EXP_CLASS::ZERO || exp_class == EXP_CLASS::INFINITE ) {
-        // 0 or inf
-        // 
-        rr = 0;
-    } else if ( exp_class == EXP_CLASS::NOT_A_NUMBER ) {
-        // NaN
-        rr = x | _quiet_NaN_fxd;
+    } else if ( y_exp_class == EXP_CLASS::INFINITE ) {
+        // PI/2
+        rr = y_sign ? neg( _pi_div_2, false ) : _pi_div_2;
 
     } else {
-        cassert( exp_class == EXP_CLASS::NORMAL || exp_class == EXP_CLASS::SUBNORMAL,
-                 "atan2: unexpected exp_class=" + to_str(exp_class) );
-        exp_class = EXP_CLASS::NORMAL;
-
-        // reduce
-        T xx, yy;
-        circular_vectoring( x, y, _zero, xx, yy, rr );
+        // normal case
+        //
+        T x = _x;
+        T y = _y;
+        EXP_CLASS exp_class;
+        int32_t   exp;
+        reduce_hypot_args( x, y, exp_class, exp, swapped );
 
-        did_neg = rr < 0;
-        if ( did_neg ) {
-            rr = -rr;
-            rr_sign = !rr_sign;
+        T xx, yy, zz;
+        const bool is_cordic = _fn_backend[uint32_t(FN_KERNEL::ATAN)] == FN_BACKEND::CORDIC;
+        if ( is_cordic ) {
+            circular_vectoring( x, y, _zero_fxd, xx, yy, zz );
+        } else {
+            zz = fn_approx_eval( _fn_approx[uint32_t(FN_KERNEL::ATAN)][0], div_fxd( y, x ) );   // r is left to hypot() below
+        }
+        if ( y == 0 || zz < 0 ) zz = 0;
+        if ( swapped ) zz = (_pi_fxd >> 1) - zz;
+        if ( x_sign  ) zz = _pi_fxd - zz;
+        rr = zz;
+        reconstruct( rr, (rr == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, y_sign );
+        if ( r != nullptr && is_cordic ) {
+            *r = mul_fxd( xx, _circular_vectoring_one_over_gain_fxd );
+            reconstruct( *r, exp_class, exp, false );
+            r = nullptr;
         }
     }
+    if ( r != nullptr ) *r = hypot( _x, _y, false );
 
-    reconstruct( rr, exp_class, 0, rr_sign );
-    rr = scalbn( rr, 1, false );
-    if ( swapped ) rr = sub( did_neg ? _neg_pi : _pi, rr, false );
     if ( is_final ) rr = rfrac( rr );
     if ( debug ) std::cout << "atan2 end: y=" << _to_flt(_y) << " x=" << _to_flt(_x) << " x_is_one=" << x_is_one << 
-                              " swapped=" << swapped << " did_neg=" << did_neg << " atan2=" << _to_flt(rr) << 
-                              " r=" << ((r != nullptr) ? _to_flt(*r) : _to_flt(_zero)) << "\n";
+                              " swapped=" << swapped << " atan2=" << _to_flt(rr) << "\n";
     return rr;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::polar_to_rect( const T& r, const T& a, T& x, T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::polar_to_rect( const T& r, const T& a, T& x, T& y ) const
 {
+    _cr_2_2( polar_to_rect, r, a, x, y );
     _log_4( polar_to_rect, r, a, x, y );
     if ( debug ) std::cout << "polar_to_rect begin: r=" << _to_flt(r) << " a=" << _to_flt(a) << "\n";
     sincos( false, a, y, x, false, true, true, &r );
@@ -3808,9 +6948,10 @@ inline void Cordic<T,FLT>::polar_to_rect( const T& r, const T& a, T& x, T& y ) c
     y = rfrac( y );
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::rect_to_polar( const T& x, const T& y, T& r, T& a ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::rect_to_polar( const T& x, const T& y, T& r, T& a ) const
 {
+    _cr_2_2( rect_to_polar, x, y, r, a );
     _log_4( rect_to_polar, x, y, r, a );
     if ( debug ) std::cout << "rect_to_polar begin: x=" << _to_flt(x) << " y=" << _to_flt(y) << "\n";
     a = atan2( y, x, false, false, &r );
@@ -3818,8 +6959,8 @@ inline void Cordic<T,FLT>::rect_to_polar( const T& x, const T& y, T& r, T& a ) c
     a = rfrac( a );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypot( const T& _x, const T& _y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypot( const T& _x, const T& _y, bool is_final ) const
 {
     if ( is_final ) _log_2( hypot, _x, _y );
     T x = _x;
@@ -3835,21 +6976,22 @@ inline T Cordic<T,FLT>::hypot( const T& _x, const T& _y, bool is_final ) const
         circular_vectoring_xy( x, y, xx, yy );
     } 
     reconstruct( xx, exp_class, exp, false );
-    xx = mulc( xx, _circular_vectoring_one_over_gain, false );
+    xx = mulc( xx, MULC::circular_vectoring_one_over_gain, false );
     if ( is_final ) xx = rfrac( xx );
     if ( debug ) std::cout << "hypot end: x_orig=" << _to_flt(_x, is_final) << 
                                         " y_orig=" << _to_flt(_y, is_final) << " hypot=" << _to_flt(xx, is_final) << "\n";
     return xx;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypot( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypot( const T& x, const T& y ) const
 {
+    _cr_2( hypot, x, y );
     return hypot( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypoth( const T& x, const T& y, bool is_final ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypoth( const T& x, const T& y, bool is_final ) const
 {
     //-----------------------------------------------------
     // Identities:
@@ -3868,15 +7010,19 @@ inline T Cordic<T,FLT>::hypoth( const T& x, const T& y, bool is_final ) const
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::hypoth( const T& x, const T& y ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::hypoth( const T& x, const T& y ) const
 {
+    _cr_2( hypoth, x, y );
     return hypoth( x, y, true );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::sinh( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::sinh( const T& x, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1( sinh, x );
+    }
     if ( r != nullptr ) {
         _log_2( sinh, x, *r );
     } else {
@@ -3890,9 +7036,12 @@ inline T Cordic<T,FLT>::sinh( const T& x, const T * r ) const
     return sih;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::cosh( const T& x, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::cosh( const T& x, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1( cosh, x );
+    }
     if ( r != nullptr ) {
         _log_2( cosh, x, *r );
     } else {
@@ -3906,16 +7055,19 @@ inline T Cordic<T,FLT>::cosh( const T& x, const T * r ) const
     return coh;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::sinhcosh( const T& x, T& sih, T& coh, const T * r ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::sinhcosh( const T& x, T& sih, T& coh, const T * r ) const
 { 
+    if ( r == nullptr ) {
+        _cr_1_2( sinhcosh, x, sih, coh );
+    }
     sinhcosh( x, sih, coh, true, true, true, r );
     if ( debug ) std::cout << "sinhcosh end: x_orig=" << _to_flt(x) << " sinh=" << _to_flt(sih) << " cosh=" << _to_flt(coh) << 
                               " r=" << ((r != nullptr) ? _to_flt(*r) : 1.0) << "\n";
 }
 
-template< typename T, typename FLT >
-void Cordic<T,FLT>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool need_sih, bool need_coh, const T * _r ) const
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool need_sih, bool need_coh, const T * _r ) const
 { 
     if ( is_final ) {
         if ( _r != nullptr ) {
@@ -3928,21 +7080,85 @@ void Cordic<T,FLT>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool n
     T x = _x;
 
     //-----------------------------------------------------
-    // sinh(x) = (exp(x) - 1/exp(x))/2
-    // cosh(x) = (exp(x) + 1/exp(x))/2
-    //
-    // Currently, this appears more efficient than other techniques that don't use a LUT.
+    // Identities:
+    //     sinh(-x)   = -sinh(x)
+    //     cosh(-x)   = cosh(x)
+    //     x          = i*log(2) + f
+    //     exp(+/-x)  = 2^(+/-i) * (cosh(f) +/- sinh(f))
+    //     sinh(x)    = 2^(i-1) * (exp(f) - 2^-2i*exp(-f))
+    //     cosh(x)    = 2^(i-1) * (exp(f) + 2^-2i*exp(-f))
+    // Strategy:
+    //     sinhcosh_fxd() does one hyperbolic_rotation() of (r/(2*gain), 0, f),
+    //     where a normal r is folded in like sincos() does.  Otherwise, multiply at the end.
+    //     For |x| < 1/2, sinhcosh_series_fxd() instead, because exp(f) - exp(-f) cancels.
     //-----------------------------------------------------
-    T expx = exp( x, false );
-    T one_over_expx = div( _one, expx, false );
-    if ( _r != nullptr ) expx = mul( expx, *_r, false );
-    if ( need_sih ) {
-        sih = sub( expx, one_over_expx, false );
-        sih = scalbn( sih, -1, false );
+    T         r;
+    EXP_CLASS r_exp_class;
+    int32_t   r_exp;
+    bool      r_sign;
+    reduce_r_arg( _r, r, r_exp_class, r_exp, r_sign );
+    bool mul_r = r_exp_class != EXP_CLASS::NORMAL;
+    if ( mul_r ) {
+        r      = _one_fxd;
+        r_exp  = 0;
+        r_sign = false;
+    }
+
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+
+    // check for special cases
+    //
+    if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // x is the answer
+        sih = _x;
+        coh = _x;
+        mul_r = _r != nullptr;
+
+    } else if ( x_exp_class == EXP_CLASS::ZERO ) {
+        // +/-0 and 1
+        sih = _x;
+        coh = _one;
+        mul_r = _r != nullptr;
+
+    } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
+        // +/-inf and +inf
+        sih = _x;
+        coh = infinity();
+        mul_r = _r != nullptr;
+
+    } else if ( 2*x_exp < -int32_t(_frac_guard_w) ) {
+        // x^2/2 is below the guard bits: r*x and r
+        sih = mul_fxd( x, r );
+        coh = r;
+        reconstruct( sih, EXP_CLASS::NORMAL, x_exp + r_exp, x_sign ^ r_sign );
+        reconstruct( coh, EXP_CLASS::NORMAL, r_exp, r_sign );
+
+    } else if ( x_exp < -1 ) {
+        // |x| < 1/2: the series keep sinh(x)'s relative precision
+        sinhcosh_series_fxd( x, x_exp, sih, coh );
+        sih = mul_fxd( sih, r );
+        coh = mul_fxd( coh, r );
+        reconstruct( sih, EXP_CLASS::NORMAL, x_exp + r_exp, x_sign ^ r_sign );
+        reconstruct( coh, EXP_CLASS::NORMAL, r_exp, r_sign );
+
+    } else {
+        T       e_pos;
+        T       e_neg;
+        int32_t i;
+        sinhcosh_fxd( _x, x, x_exp, r, e_pos, e_neg, i );
+        sih = e_pos - e_neg;
+        coh = e_pos + e_neg;
+        if ( sih < 0 ) sih = 0;
+        reconstruct( sih, (sih == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp + i, x_sign ^ r_sign );
+        reconstruct( coh, EXP_CLASS::NORMAL, r_exp + i, r_sign );
     }
-    if ( need_coh ) {
-        coh = add( expx, one_over_expx, false );
-        coh = scalbn( coh, -1, false );
+
+    if ( mul_r ) {
+        if ( need_sih ) sih = mul( sih, *_r, false );
+        if ( need_coh ) coh = mul( coh, *_r, false );
     }
 
     if ( is_final ) {
@@ -3951,58 +7167,238 @@ void Cordic<T,FLT>::sinhcosh( const T& _x, T& sih, T& coh, bool is_final, bool n
     }
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::tanh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::tanh( const T& _x ) const
 { 
-    _log_1( tanh, x );
-    T sih, coh;
-    sinhcosh( x, sih, coh, false, true, true, nullptr );
-    T r = div( sih, coh, false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "tanh end: x_orig=" << _to_flt(x) << " tanh=" << _to_flt(r) << "\n";
+    _cr_1( tanh, _x );
+    //-----------------------------------------------------
+    // Identities:
+    //     tanh(-x) = -tanh(x)
+    //     tanh(x)  = sinh(x) / cosh(x) = (exp(f) - 2^-2i*exp(-f)) / (exp(f) + 2^-2i*exp(-f))
+    // Strategy:
+    //     Get the two exps from sinhcosh_fxd() and divide them while still in fixed-point.
+    //     The gain and 2^(i-1) cancel.  For |x| < 1/2, sinhcosh_series_fxd() instead,
+    //     which keeps sinh(x)'s own exponent.
+    //-----------------------------------------------------
+    _log_1( tanh, _x );
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+
+    // check for special cases
+    //
+    T r;
+    if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER || x_exp_class == EXP_CLASS::ZERO ) {
+        // x is the answer
+        r = _x;
+
+    } else if ( x_exp_class == EXP_CLASS::INFINITE ) {
+        // +/-1
+        r = x_sign ? _neg_one : _one;
+
+    } else if ( 2*x_exp < -int32_t(_frac_guard_w) ) {
+        // x^3/3 is below the guard bits
+        r = _x;
+
+    } else if ( x_exp < -1 ) {
+        T sih;
+        T coh;
+        sinhcosh_series_fxd( x, x_exp, sih, coh );
+        int32_t r_exp;
+        r = ratio_fxd( sih, coh, r_exp );
+        reconstruct( r, EXP_CLASS::NORMAL, r_exp + x_exp, x_sign );
+        r = rfrac( r );
+
+    } else {
+        T       e_pos;
+        T       e_neg;
+        int32_t i;
+        sinhcosh_fxd( _x, x, x_exp, _one_fxd, e_pos, e_neg, i );
+        T sih = e_pos - e_neg;
+        T coh = e_pos + e_neg;
+        int32_t r_exp = 0;
+        r = (sih <= 0) ? T(0) : ratio_fxd( sih, coh, r_exp );
+        reconstruct( r, (r == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, r_exp, x_sign );
+        r = rfrac( r );
+    }
+
+    if ( debug ) std::cout << "tanh end: x_orig=" << _to_flt(_x) << " tanh=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::asinh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::asinh( const T& x ) const
 { 
+    _cr_1( asinh, x );
     _log_1( asinh, x );
-    T h = hypot( x, _one, false );
-    T r = log( add( x, h, false ), false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "asinh end: x_orig=" << _to_flt(x) << " asinh=" << _to_flt(r) << "\n";
-    return r;
+    return asinh_acosh( false, x );
+}
+
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::acosh( const T& x ) const
+{ 
+    _cr_1( acosh, x );
+    _log_1( acosh, x );
+    return asinh_acosh( true, x );
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::acosh( const T& x ) const
-{ 
-    _log_1( acosh, x );
-    T hh = hypoth( x, _one, false );
-    T r = log( add( x, hh, false ), false );
-    r = rfrac( r );
-    if ( debug ) std::cout << "acosh end: x_orig=" << _to_flt(x) << " acosh=" << _to_flt(r) << "\n";
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::asinh_acosh( bool is_acosh, const T& _x ) const
+{
+    //-----------------------------------------------------
+    // Identities:
+    //     asinh(-x) = -asinh(x)
+    //     asinh(x)  = atanh(x/sqrt(x^2+1))  = log(x + sqrt(x^2+1))
+    //     acosh(x)  = atanh(sqrt(x^2-1)/x)  = log(x + sqrt(x^2-1))
+    //     x^2-1     = (x-1)*(x+1)
+    // Strategy:
+    //     Stay in fixed-point after deconstruct().  Each way takes two CORDIC passes:
+    //
+    //     For asinh |x| < 1/2, s = sqrt(x^2+1) takes one vectoring pass.  Then asinh(x) = 2*atanh(u)
+    //     with u = (x+s-1)/(x+s+1) = x*(1 + x/(s+1))/(x+s+1) <= 1/4, and atanh_fxd() keeps the
+    //     mantissa of x normalized all the way, so small x keep their relative precision.
+    //
+    //     For asinh x < 1 or acosh x < 1.5, get the sqrt with one vectoring pass, then hyperbolic
+    //     vectoring of (sqrt, x) or (x, sqrt) leaves the answer in z.  For acosh, x-1 is exact
+    //     and is normalized first so that the sqrt keeps its precision near x == 1.
+    //
+    //     Otherwise, x=m*2^e and w = m + sqrt(m^2 +/- 2^-2e) takes one vectoring pass,
+    //     and the answer is log(w) + e*log(2), where log(w) takes the second.  The sum is
+    //     formed in fixed-point, scaled down by 2^k with 2^k > e+1, so nothing is rounded twice.
+    //-----------------------------------------------------
+    const char * kind = is_acosh ? "acosh" : "asinh";
+    if ( debug ) std::cout << kind << " begin: x_orig=" << _to_flt(_x) << "\n";
+    T x = _x;
+    EXP_CLASS x_exp_class;
+    int32_t   x_exp;
+    bool      x_sign;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+        // normalize
+        int32_t shift = clz( x ) - _one_fxd_clz;
+        x <<= shift;
+        x_exp -= shift;
+        x_exp_class = EXP_CLASS::NORMAL;
+    }
+
+    // check for special cases
+    //
+    T r;
+    if ( x_exp_class == EXP_CLASS::NOT_A_NUMBER ) {
+        // _x is the answer
+        r = _x;
+
+    } else if ( is_acosh && (x_sign || x_exp_class == EXP_CLASS::ZERO || (x_exp_class == EXP_CLASS::NORMAL && x_exp < 0)) ) {
+        // acosh(x < 1) => NaN
+        r = quiet_NaN();
+
+    } else if ( x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::INFINITE ) {
+        // +/-0 or +/-inf is the answer
+        r = _x;
+
+    } else if ( !is_acosh && 2*x_exp < -int32_t(_frac_guard_w) ) {
+        // x^3/6 is below the guard bits
+        r = _x;
+
+    } else if ( !is_acosh && x_exp < -1 ) {
+        // 2*atanh(x*(1 + x/(s+1))/(x+s+1)) with s = sqrt(x^2+1)
+        T xx, yy;
+        T xf = x >> -x_exp;
+        circular_vectoring_xy( _one_fxd, xf, xx, yy );                  // gain*sqrt(1+x^2)
+        T s = mul_fxd( xx, _circular_vectoring_one_over_gain_fxd );
+        T f = _one_fxd + div_fxd( xf, _one_fxd + s );
+        int32_t u_exp;
+        T u = ratio_fxd( mul_fxd( x, f ), xf + s + _one_fxd, u_exp );
+        u_exp += x_exp;
+        r = atanh_fxd( u, u_exp );
+        reconstruct( r, EXP_CLASS::NORMAL, u_exp + 1, x_sign );
+        r = rfrac( r );
+
+    } else if ( !is_acosh && x_exp < 0 ) {
+        // atanh(x/sqrt(x^2+1))
+        T xx, yy;
+        T xf = (x >> 1) | (x & 1);
+        circular_vectoring_xy( _one_fxd, xf, xx, yy );                  // gain*sqrt(1+x^2)
+        T h = mul_fxd( xx, _circular_vectoring_one_over_gain_fxd );
+        hyperbolic_vectoring( h, xf, _zero_fxd, xx, yy, r );
+        reconstruct( r, (r == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, x_sign );
+        r = rfrac( r );
+
+    } else if ( is_acosh && x_exp == 0 && x < (_one_fxd + _half_fxd) ) {
+        // atanh(sqrt((x-1)*(x+1))/x), where (x-1)*(x+1) = md*(x+1) * 2^-shift
+        T d = x - _one_fxd;
+        if ( d == 0 ) {
+            r = _zero;
+        } else {
+            int32_t shift = clz( d ) - _one_fxd_clz;
+            T p = mul_fxd( d << shift, x + _one_fxd );                   // 2 .. 5
+            int32_t p_shift = (shift & 1) ? 3 : 2;                      // make the exponent even
+            p = (p >> p_shift) | T((p & ((T(1) << p_shift) - 1)) != 0);  // record sticky bit
+            int32_t sqrt_exp = (p_shift - shift) / 2;                   // <= 1
+            T xx, yy, q;
+            hyperbolic_vectoring_xy( (p + _one_fxd) >> 1, (p - _one_fxd) >> 1, q, yy );  // gain*sqrt(p)
+            if ( sqrt_exp > 0 ) {
+                q <<= sqrt_exp;                                         // gain*sqrt(x^2-1)
+            } else {
+                q >>= std::min( -sqrt_exp, int32_t(_frac_guard_w) + 1 );
+            }
+            hyperbolic_vectoring( mul_fxd( x, _hyperbolic_vectoring_gain_fxd ), q, _zero_fxd, xx, yy, r );
+            reconstruct( r, (r == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL, 0, false );
+            r = rfrac( r );
+        }
+
+    } else {
+        // log(w*2^e) with w = m + sqrt(m^2 +/- 2^-2e)
+        T c = (x_exp > int32_t(_frac_guard_w)) ? T(0) : (_one_fxd >> x_exp);
+        T xx, yy, h;
+        if ( is_acosh ) {
+            hyperbolic_vectoring_xy( x, c, xx, yy );                    // gain*sqrt(m^2 - c^2)
+            h = mul_fxd( xx, _hyperbolic_vectoring_one_over_gain_fxd );
+        } else {
+            circular_vectoring_xy( x, c, xx, yy );                      // gain*sqrt(m^2 + c^2)
+            h = mul_fxd( xx, _circular_vectoring_one_over_gain_fxd );
+        }
+        T w = x + h;                                                    // 1.8 .. 4.3
+        int32_t shift = _one_fxd_clz - clz( w );
+        if ( shift > 0 ) {
+            w = (w >> shift) | T((w & ((T(1) << shift) - 1)) != 0);     // record sticky bit
+            x_exp += shift;
+        }
+        T lg2 = log_fxd( w );                                           // log(w/2) < 0
+        int32_t n = x_exp + 1;                                          // >= 2
+        int32_t k = 1;
+        while( (int32_t(1) << k) <= n ) k++;                            // n < 2^k
+        r = mul_fxd( T(n) << (_frac_guard_w - k), _log2_fxd ) + (lg2 >> k);  // (n*log(2) + log(w/2))/2^k
+        reconstruct( r, EXP_CLASS::NORMAL, k, x_sign );
+        r = rfrac( r );
+    }
+
+    if ( debug ) std::cout << kind << " end: x_orig=" << _to_flt(_x) << " " << kind << "=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atanh( const T& x ) const
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atanh( const T& x ) const
 { 
+    _cr_1c( atanh, x, _cr_atanh_w );
     T r = atanh2( x, _one, true, true );
     if ( debug ) std::cout << "atanh end: x_orig=" << _to_flt(x) << " atanh=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-inline T Cordic<T,FLT>::atanh2( const T& y, const T& x ) const             
+template< typename T, typename FLT, typename CORE >
+inline T Cordic<T,FLT,CORE>::atanh2( const T& y, const T& x ) const             
 { 
+    _cr_2c( atanh2, y, x, _cr_atanh_w );
     T r = atanh2( y, x, true, false );
     if ( debug ) std::cout << "atanh2 end: y=" << _to_flt(y) << " x=" << _to_flt(x) << " atanh2=" << _to_flt(r) << "\n";
     return r;
 }
 
-template< typename T, typename FLT >
-T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one ) const             
+template< typename T, typename FLT, typename CORE >
+T Cordic<T,FLT,CORE>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one ) const             
 { 
     if ( debug ) std::cout << "atanh2 begin: y=" << _to_flt( _y ) << " x=" << _to_flt( _x ) << "\n";
 
@@ -4012,11 +7408,13 @@ T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one
 
     //-----------------------------------------------------
     // Identities:
-    //     atan(-x) = -atan(x)
+    //     atanh(-x)   = -atanh(x)
     //     abs(y/x) must be between 0 and 1
+    //     atanh(y/x)  = log((x+y)/(x-y)) / 2
     // Strategy:
-    //     reduce y and x for division
-    //     sum of their lshifts should be 0
+    //     Right-shift y's mantissa by the difference in exponents so that
+    //     hyperbolic vectoring of the two mantissas gives atanh(y/x) directly.
+    //     Near |y/x| == 1 that is out of range, so use the two logs instead.
     //-----------------------------------------------------
     EXP_CLASS y_exp_class;
     EXP_CLASS x_exp_class;
@@ -4039,9 +7437,20 @@ T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one
     // check for other special cases
     //
     bool sign = y_sign ^ x_sign;
-    int32_t exp = x_exp + y_exp;
+    int32_t exp = y_exp - x_exp;
+    if ( exp <= 0 ) {
+        y >>= std::min( -exp, int32_t(_frac_guard_w) + 1 );
+        exp = 0;
+    }
+    bool y_is_x = exp == 0 && y == x && (y_exp_class == EXP_CLASS::NORMAL || y_exp_class == EXP_CLASS::SUBNORMAL) &&
+                                        (x_exp_class == EXP_CLASS::NORMAL || x_exp_class == EXP_CLASS::SUBNORMAL);
     T r;
-    if ( y_exp_class == EXP_CLASS::NOT_A_NUMBER || y_exp_class == EXP_CLASS::INFINITE || exp > 0 ) {
+    if ( y_is_x ) {
+        // |y/x| == 1 => +/- inf
+        r = sign ? ninfinity() : infinity();
+
+    } else if ( y_exp_class == EXP_CLASS::NOT_A_NUMBER || y_exp_class == EXP_CLASS::INFINITE || exp > 0 ||
+                (y >= x && y_exp_class != EXP_CLASS::ZERO && x_exp_class != EXP_CLASS::INFINITE) ) {
         r = y | _quiet_NaN_fxd;
         reconstruct( r, EXP_CLASS::NOT_A_NUMBER, _exp_mask, sign );
 
@@ -4053,10 +7462,15 @@ T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one
         // y/x == 0 => return +/- 0
         r = sign ? _neg_zero : _zero;
 
-    } else {
-        y >>= -exp;
-        exp = 0;
+    } else if ( y > (x >> 1) + (x >> 2) + (x >> 5) + (x >> 6) ) {
+        // |y/x| > 51/64, close to the hyperbolic vectoring limit: log((x+y)/(x-y)) / 2
+        const T xe = x_is_one ? _one : abs( _x );
+        const T ye = sign ? neg( abs( _y ), false ) : abs( _y );
+        r = sub( log( add( xe, ye, false ), false ), log( sub( xe, ye, false ), false ), false );
+        r = scalbn( r, -1, false );
+        if ( is_final ) r = rfrac( r );
 
+    } else {
         T xx, yy;
         hyperbolic_vectoring( x, y, _zero, xx, yy, r );
         if ( r < 0 ) {
@@ -4072,8 +7486,470 @@ T Cordic<T,FLT>::atanh2( const T& _y, const T& _x, bool is_final, bool x_is_one
     return r;
 }
 
-template< typename T, typename FLT >
-typename Cordic<T,FLT>::EXP_CLASS Cordic<T,FLT>::classify( const T& _x ) const
+//-----------------------------------------------------
+// Array Versions
+//
+// The blocked versions further down go element by element through the
+// scalar functions when a logger is installed or correctly-rounded mode is on.
+//-----------------------------------------------------
+#define _array_1( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::name( const T * x, T * r, size_t n ) const \
+    { \
+        for( size_t k = 0; k < n; k++ ) r[k] = name( x[k] ); \
+    }
+#define _array_2( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::name( const T * x, const T * y, T * r, size_t n ) const \
+    { \
+        for( size_t k = 0; k < n; k++ ) r[k] = name( x[k], y[k] ); \
+    }
+#define _array_3( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::name( const T * x, const T * y, const T * z, T * r, size_t n ) const \
+    { \
+        for( size_t k = 0; k < n; k++ ) r[k] = name( x[k], y[k], z[k] ); \
+    }
+#define _array_1_2( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::name( const T * x, T * r1, T * r2, size_t n ) const \
+    { \
+        for( size_t k = 0; k < n; k++ ) name( x[k], r1[k], r2[k] ); \
+    }
+#define _array_2_2( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::name( const T * x, const T * y, T * r1, T * r2, size_t n ) const \
+    { \
+        for( size_t k = 0; k < n; k++ ) name( x[k], y[k], r1[k], r2[k] ); \
+    }
+
+_array_1( sqrt )
+_array_1( rsqrt )
+_array_1( cbrt )
+_array_1( rcbrt )
+_array_1( expm1 )
+_array_2( pow )
+_array_1( log )
+_array_1( log1p )
+_array_1( log2 )
+_array_1( log10 )
+_array_1( deg2rad )
+_array_1( rad2deg )
+_array_1( tan )
+_array_1( tanpi )
+_array_1( asin )
+_array_1( acos )
+_array_1( atan )
+_array_2( atan2 )
+_array_2_2( polar_to_rect )
+_array_2_2( rect_to_polar )
+_array_2( hypoth )
+_array_1( sinh )
+_array_1( cosh )
+_array_1_2( sinhcosh )
+_array_1( tanh )
+_array_1( asinh )
+_array_1( acosh )
+_array_1( atanh )
+_array_2( atanh2 )
+_array_1( abs )
+_array_1( neg )
+_array_1( floor )
+_array_1( ceil )
+_array_1( trunc )
+_array_1( round )
+_array_2( add )
+_array_2( sub )
+_array_3( fma )
+_array_2( mul )
+_array_1( sqr )
+_array_3( fda )
+_array_2( div )
+_array_2( remainder )
+_array_2( fmod )
+_array_1( rcp )
+_array_2( fdim )
+_array_2( fmax )
+_array_2( fmin )
+
+#undef _array_1
+#undef _array_2
+#undef _array_3
+#undef _array_1_2
+#undef _array_2_2
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sin( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = sin( x[k] );
+        return;
+    }
+    sincos_array( false, x, r, nullptr, n, false, true, false );
+    const int rmode = fegetround();
+    for( size_t k = 0; k < n; k++ ) r[k] = rfrac( r[k], rmode );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sinpi( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = sinpi( x[k] );
+        return;
+    }
+    sincos_array( true, x, r, nullptr, n, false, true, false );
+    const int rmode = fegetround();
+    for( size_t k = 0; k < n; k++ ) r[k] = rfrac( r[k], rmode );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::cos( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = cos( x[k] );
+        return;
+    }
+    sincos_array( false, x, nullptr, r, n, false, false, true );
+    const int rmode = fegetround();
+    for( size_t k = 0; k < n; k++ ) r[k] = rfrac( r[k], rmode );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::cospi( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = cospi( x[k] );
+        return;
+    }
+    sincos_array( true, x, nullptr, r, n, false, false, true );
+    const int rmode = fegetround();
+    for( size_t k = 0; k < n; k++ ) r[k] = rfrac( r[k], rmode );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos( const T * x, T * si, T * co, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) sincos( x[k], si[k], co[k] );
+        return;
+    }
+    sincos_array( false, x, si, co, n, true, true, true );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sinpicospi( const T * x, T * si, T * co, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) sinpicospi( x[k], si[k], co[k] );
+        return;
+    }
+    sincos_array( true, x, si, co, n, true, true, true );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::sincos_array( bool times_pi, const T * x, T * si, T * co, size_t n, bool is_final, bool need_si, bool need_co ) const
+{
+    //-----------------------------------------------------
+    // Same as the scalar sincos(), but one block at a time:
+    //
+    // 1) reduce each x and pack the normal ones into a[]; special cases go through the scalar version
+    // 2) one batch circular_rotation() on the packed a[]
+    // 3) sincos_finish() on each and scatter the results
+    //-----------------------------------------------------
+    T        g[ARRAY_BLOCK];
+    T        zero[ARRAY_BLOCK];
+    T        a[ARRAY_BLOCK];
+    T        s[ARRAY_BLOCK];
+    T        c[ARRAY_BLOCK];
+    T        zz[ARRAY_BLOCK];
+    uint32_t quadrant[ARRAY_BLOCK];
+    bool     sign[ARRAY_BLOCK];
+    bool     did_minus_pi_div_4[ARRAY_BLOCK];
+    size_t   idx[ARRAY_BLOCK];
+    for( size_t l = 0; l < ARRAY_BLOCK; l++ )
+    {
+        g[l]    = _circular_rotation_one_over_gain_fxd;
+        zero[l] = _zero;
+    }
+
+    for( size_t k0 = 0; k0 < n; k0 += ARRAY_BLOCK )
+    {
+        size_t m   = std::min( n - k0, ARRAY_BLOCK );
+        size_t cnt = 0;
+        for( size_t k = k0; k < (k0+m); k++ )
+        {
+            EXP_CLASS x_exp_class;
+            a[cnt] = x[k];
+            reduce_sincos_arg( times_pi, a[cnt], quadrant[cnt], x_exp_class, sign[cnt], did_minus_pi_div_4[cnt] );
+            if ( x_exp_class == EXP_CLASS::NORMAL || x_exp_class == EXP_CLASS::SUBNORMAL ) {
+                idx[cnt++] = k;
+            } else {
+                T sk, ck;
+                sincos( times_pi, x[k], sk, ck, is_final, need_si, need_co, nullptr );
+                if ( need_si ) si[k] = sk;
+                if ( need_co ) co[k] = ck;
+            }
+        }
+
+        if ( _sincos_lut_w != 0 || _fn_backend[uint32_t(FN_KERNEL::SINCOS)] != FN_BACKEND::CORDIC ) {
+            for( size_t l = 0; l < cnt; l++ ) sincos_fxd( a[l], c[l], s[l] );
+        } else {
+            circular_rotation( cnt, g, zero, a, c, s, zz );
+        }
+
+        for( size_t l = 0; l < cnt; l++ )
+        {
+            if ( a[l] == 0 ) {
+                c[l] = _one_fxd;                                        // exact, like the scalar sincos()
+                s[l] = 0;
+            }
+            sincos_finish( s[l], c[l], quadrant[l], sign[l], did_minus_pi_div_4[l], is_final, need_si, need_co, 0, false, nullptr );
+            if ( need_si ) si[idx[l]] = s[l];
+            if ( need_co ) co[idx[l]] = c[l];
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::exp( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = exp( x[k] );
+        return;
+    }
+    exp_array( M_E, x, r, n );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::exp2( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = exp2( x[k] );
+        return;
+    }
+    exp_array( 2.0, x, r, n );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::exp10( const T * x, T * r, size_t n ) const
+{
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = exp10( x[k] );
+        return;
+    }
+    exp_array( 10.0, x, r, n );
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::exp_array( FLT b, const T * x, T * r, size_t n ) const
+{
+    //-----------------------------------------------------
+    // Same as the scalar exp( x, true, b ), but one block at a time.
+    //-----------------------------------------------------
+    T         g[ARRAY_BLOCK];
+    T         a[ARRAY_BLOCK];
+    T         xx[ARRAY_BLOCK];
+    T         yy[ARRAY_BLOCK];
+    T         zz[ARRAY_BLOCK];
+    int32_t   i[ARRAY_BLOCK];
+    EXP_CLASS x_exp_class[ARRAY_BLOCK];
+    size_t    idx[ARRAY_BLOCK];
+    for( size_t l = 0; l < ARRAY_BLOCK; l++ ) g[l] = _hyperbolic_rotation_one_over_gain_fxd;
+    const int rmode = fegetround();
+
+    for( size_t k0 = 0; k0 < n; k0 += ARRAY_BLOCK )
+    {
+        size_t m   = std::min( n - k0, ARRAY_BLOCK );
+        size_t cnt = 0;
+        for( size_t k = k0; k < (k0+m); k++ )
+        {
+            bool x_sign;
+            a[cnt] = x[k];
+            reduce_exp_arg( b, a[cnt], i[cnt], x_exp_class[cnt], x_sign );
+            if ( x_exp_class[cnt] == EXP_CLASS::NORMAL || x_exp_class[cnt] == EXP_CLASS::SUBNORMAL ) {
+                idx[cnt++] = k;
+            } else {
+                r[k] = exp( x[k], true, b );
+            }
+        }
+
+        if ( _exp_log_lut_w != 0 || _fn_backend[uint32_t(FN_KERNEL::EXP)] != FN_BACKEND::CORDIC ) {
+            for( size_t l = 0; l < cnt; l++ ) xx[l] = exp_fxd( a[l] );
+        } else {
+            hyperbolic_rotation( cnt, g, g, a, xx, yy, zz );
+        }
+
+        for( size_t l = 0; l < cnt; l++ )
+        {
+            reconstruct( xx[l], x_exp_class[l], 0, false );
+            r[idx[l]] = rfrac( scalbn( xx[l], i[l], false ), rmode );
+        }
+    }
+}
+
+template< typename T, typename FLT, typename CORE >
+void Cordic<T,FLT,CORE>::hypot( const T * x, const T * y, T * r, size_t n ) const
+{
+    //-----------------------------------------------------
+    // Same as the scalar hypot( x, y, true ), but one block at a time.
+    //-----------------------------------------------------
+    if ( logger != nullptr || _cr_level_cnt != 0 ) {
+        for( size_t k = 0; k < n; k++ ) r[k] = hypot( x[k], y[k] );
+        return;
+    }
+
+    T         a[ARRAY_BLOCK];
+    T         b[ARRAY_BLOCK];
+    T         xx[ARRAY_BLOCK];
+    T         yy[ARRAY_BLOCK];
+    int32_t   exp[ARRAY_BLOCK];
+    EXP_CLASS exp_class[ARRAY_BLOCK];
+    size_t    idx[ARRAY_BLOCK];
+    const int rmode = fegetround();
+    for( size_t k0 = 0; k0 < n; k0 += ARRAY_BLOCK )
+    {
+        size_t m   = std::min( n - k0, ARRAY_BLOCK );
+        size_t cnt = 0;
+        for( size_t k = k0; k < (k0+m); k++ )
+        {
+            bool swapped;
+            a[cnt] = x[k];
+            b[cnt] = y[k];
+            reduce_hypot_args( a[cnt], b[cnt], exp_class[cnt], exp[cnt], swapped );
+            if ( exp_class[cnt] == EXP_CLASS::NORMAL || exp_class[cnt] == EXP_CLASS::SUBNORMAL ) {
+                idx[cnt++] = k;
+            } else {
+                r[k] = hypot( x[k], y[k], true );
+            }
+        }
+
+        circular_vectoring_xy( cnt, a, b, xx, yy );
+
+        for( size_t l = 0; l < cnt; l++ )
+        {
+            reconstruct( xx[l], exp_class[l], exp[l], false );
+            r[idx[l]] = rfrac( mulc( xx[l], MULC::circular_vectoring_one_over_gain, false ), rmode );
+        }
+    }
+}
+
+//-----------------------------------------------------
+// Parallel Array Versions
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+inline Cordic<T,FLT,CORE>::Parallel::Parallel( const Cordic<T,FLT,CORE> * _cordic, ThreadPool * _pool, size_t _grain )
+{
+    cordic = _cordic;
+    pool   = _pool;
+    grain  = _grain;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::Parallel Cordic<T,FLT,CORE>::parallel( ThreadPool& pool, size_t grain ) const
+{
+    return Parallel( this, &pool, grain );
+}
+
+template< typename T, typename FLT, typename CORE >
+template< typename FN >
+void Cordic<T,FLT,CORE>::Parallel::run( size_t n, const FN& fn ) const
+{
+    if ( logger != nullptr ) {
+        fn( 0, n );
+        return;
+    }
+
+    //-----------------------------------------------------
+    // Each chunk runs with the caller's rounding mode, which may 
+    // differ from the Cordic's own if the caller is itself in a chunk.
+    //-----------------------------------------------------
+    int rmode = cordic->fegetround();
+    const Cordic<T,FLT,CORE> * prec_cordic = _thread_prec_cordic;
+    uint32_t              prec_bits   = _thread_prec_bits;
+    pool->parallel_for( n, grain, [&]( size_t begin, size_t end ) 
+    {
+        const Cordic<T,FLT,CORE> * prev_rcordic = _thread_rounding_cordic;
+        int                   prev_rmode   = _thread_rounding_mode;
+        _thread_rounding_cordic = cordic;
+        _thread_rounding_mode   = rmode;
+        if ( prec_cordic != nullptr ) {
+            Precision p( prec_cordic, prec_bits );
+            fn( begin, end );
+        } else {
+            fn( begin, end );
+        }
+        _thread_rounding_cordic = prev_rcordic;
+        _thread_rounding_mode   = prev_rmode;
+    } );
+}
+
+//-----------------------------------------------------
+// Precision Scope
+//-----------------------------------------------------
+template< typename T, typename FLT, typename CORE >
+inline Cordic<T,FLT,CORE>::Precision::Precision( const Cordic<T,FLT,CORE> * cordic, uint32_t bits )
+{
+    cassert( bits != 0, "Precision bits must be > 0" );
+    prev_cordic         = _thread_prec_cordic;
+    prev_bits           = _thread_prec_bits;
+    _thread_prec_cordic = cordic;
+    _thread_prec_bits   = bits;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline Cordic<T,FLT,CORE>::Precision::~Precision()
+{
+    _thread_prec_cordic = prev_cordic;
+    _thread_prec_bits   = prev_bits;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline typename Cordic<T,FLT,CORE>::Precision Cordic<T,FLT,CORE>::precision( uint32_t bits ) const
+{
+    return Precision( this, bits );
+}
+
+#define _pdef_1( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::Parallel::name( const T * x, T * r, size_t n ) const \
+    { \
+        run( n, [&]( size_t b, size_t e ) { cordic->name( x+b, r+b, e-b ); } ); \
+    }
+#define _pdef_2( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::Parallel::name( const T * x, const T * y, T * r, size_t n ) const \
+    { \
+        run( n, [&]( size_t b, size_t e ) { cordic->name( x+b, y+b, r+b, e-b ); } ); \
+    }
+#define _pdef_3( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::Parallel::name( const T * x, const T * y, const T * z, T * r, size_t n ) const \
+    { \
+        run( n, [&]( size_t b, size_t e ) { cordic->name( x+b, y+b, z+b, r+b, e-b ); } ); \
+    }
+#define _pdef_1_2( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::Parallel::name( const T * x, T * r1, T * r2, size_t n ) const \
+    { \
+        run( n, [&]( size_t b, size_t e ) { cordic->name( x+b, r1+b, r2+b, e-b ); } ); \
+    }
+#define _pdef_2_2( name ) \
+    template< typename T, typename FLT, typename CORE > \
+    void Cordic<T,FLT,CORE>::Parallel::name( const T * x, const T * y, T * r1, T * r2, size_t n ) const \
+    { \
+        run( n, [&]( size_t b, size_t e ) { cordic->name( x+b, y+b, r1+b, r2+b, e-b ); } ); \
+    }
+
+_CORDIC_ARRAY_FUNCS( _pdef_1, _pdef_2, _pdef_3, _pdef_1_2, _pdef_2_2 )
+
+#undef _pdef_1
+#undef _pdef_2
+#undef _pdef_3
+#undef _pdef_1_2
+#undef _pdef_2_2
+
+template< typename T, typename FLT, typename CORE >
+typename Cordic<T,FLT,CORE>::EXP_CLASS Cordic<T,FLT,CORE>::classify( const T& _x ) const
 {
     T x = _x;
     EXP_CLASS x_exp_class;
@@ -4083,16 +7959,16 @@ typename Cordic<T,FLT>::EXP_CLASS Cordic<T,FLT>::classify( const T& _x ) const
     return x_exp_class;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& sign, bool allow_debug ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& sign, bool allow_debug ) const
 {
     T x_orig = x;
-    if ( _is_float ) {
+    if ( fmt_is_float() ) {
         // FLOAT => already in the correct format
         //
-        uint32_t exp_biased = (x >> _frac_guard_w) & _exp_mask;
-                 sign       = (x >> (_w-1)) & 1;
-                 x         &= _frac_guard_mask;     // mantissa without implicit 1.
+        uint32_t exp_biased = (x >> fmt_frac_guard_w()) & fmt_exp_mask();
+                 sign       = (x >> (fmt_w()-1)) & 1;
+                 x         &= fmt_frac_guard_mask();     // mantissa without implicit 1.
         if ( debug && allow_debug ) std::cout << "\ndeconstruct: sign=" << sign << " exp_biased=" << exp_biased << 
                                                  " frac_guard=" << std::hex << x << std::dec << "\n";
         if ( exp_biased == 0 ) {
@@ -4101,7 +7977,8 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
             } else {
                 x_exp_class = EXP_CLASS::SUBNORMAL;     // FIXIT: probably best to normalize at this point
             }
-        } else if ( exp_biased == _exp_mask ) {
+            x_exp       = 1 - fmt_exp_bias();                // same exponent as smallest normal, but no implicit 1.
+        } else if ( exp_biased == fmt_exp_mask() ) {
             if ( x == 0 ) {
                 x_exp_class = EXP_CLASS::INFINITE;
             } else {
@@ -4110,8 +7987,8 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
             x_exp       = 0;
         } else {
             x_exp_class = EXP_CLASS::NORMAL;
-            x_exp       = int32_t(exp_biased) - _exp_bias; 
-            x          |= _one_fxd;    // add in implicit 1.
+            x_exp       = int32_t(exp_biased) - fmt_exp_bias(); 
+            x          |= fmt_one_fxd();    // add in implicit 1.
         }
     } else {
         // FIXED => normalize to look like floating-point (even if we lose some bits right-shifting)
@@ -4125,16 +8002,13 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
             sign = x < 0;
             if ( sign ) x = -x;
 
-            while( x > _one_fxd )
-            {
-                x_exp++;
-                x = (x >> 1) | (x & 1);    // must record sticky bit
-            }
-            while( x < _one_fxd )
-            {
-                x_exp--;
-                x <<= 1;
+            int32_t shift = fmt_one_fxd_clz() - clz( x );
+            if ( shift > 0 ) {
+                x = (x >> shift) | T((x & ((T(1) << shift) - 1)) != 0);   // must record sticky bit
+            } else {
+                x <<= -shift;
             }
+            x_exp += shift;
         }
     }
     if ( debug && allow_debug ) std::cout << "deconstruct: x_orig_f=" << _to_flt(x_orig) << " x_orig=" << std::hex << x_orig << 
@@ -4143,18 +8017,18 @@ inline void Cordic<T,FLT>::deconstruct( T& x, EXP_CLASS& x_exp_class, int32_t& x
                                              " sign=" << sign << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_exp, bool sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_exp, bool sign ) const
 {
     T x_orig = x;
     if ( debug ) std::cout << "reconstruct: x_orig=" << std::hex << x << std::dec << " x_orig_f=" << _to_flt(x, false, true) <<
                               " x_exp_class=" + to_str(x_exp_class) << " x_exp=" << x_exp << " sign=" << sign << "\n";
     int32_t exp = 0;
-    if ( _is_float ) {
+    if ( fmt_is_float() ) {
         // FLOAT
         //
-        T int_part = x >> _frac_guard_w;
-        x &= _frac_guard_mask;                                  // lop off the implicit 1.
+        T int_part = x >> fmt_frac_guard_w();
+        x &= fmt_frac_guard_mask();                                  // lop off the implicit 1.
         switch( x_exp_class )
         {
             case EXP_CLASS::ZERO:
@@ -4165,42 +8039,48 @@ inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_e
             case EXP_CLASS::NORMAL:
             case EXP_CLASS::SUBNORMAL:     
                 cassert( int_part != 0 || x != 0, "reconstruct() normal int_part or frac_part should be non-zero" );
-                while( int_part == 0 ) 
-                {
-                    int_part = (x >> (_frac_guard_w-1)) & 1;
-                    x = (x << 1) & _frac_guard_mask;
-                    x_exp--;
-                }
-                while( int_part > 1 ) 
-                {
-                    x = (x >> 1) | ((int_part&1) << (_frac_guard_w-1)) | (x & 1);
-                    int_part >>= 1;
-                    x_exp++;
+                if ( int_part == 0 ) {
+                    int32_t shift = clz( x ) - fmt_one_fxd_clz();
+                    x = (x << shift) & fmt_frac_guard_mask();
+                    int_part = 1;
+                    x_exp -= shift;
+                } else if ( int_part > 1 ) {
+                    x |= int_part << fmt_frac_guard_w();
+                    int32_t shift = fmt_one_fxd_clz() - clz( x );
+                    x = (x >> shift) | T((x & ((T(1) << shift) - 1)) != 0);   // record sticky bit
+                    int_part = x >> fmt_frac_guard_w();
+                    x &= fmt_frac_guard_mask();
+                    x_exp += shift;
                 }
                 cassert( int_part == 1, "reconstruct() normal int_part should be exactly 1, int=" + std::to_string(int_part) + 
                                         + " frac=" + std::to_string(x) + " x_orig=" + std::to_string(x_orig) );
 
-                exp = x_exp + _exp_bias;
-                if ( exp < 0 ) {
-                    // subnormal
-                    exp = -exp;
-                    T mask = (T(1) << exp) - 1;
-                    x = (x >> exp) | ((x & mask) != 0);
+                exp = x_exp + fmt_exp_bias();
+                if ( exp <= 0 ) {
+                    // subnormal: same exponent as smallest normal, so put the implicit 1. back and shift it down
+                    int32_t shift = 1 - exp;
+                    x |= fmt_one_fxd();
+                    if ( shift > int32_t(fmt_frac_guard_w()) + 1 ) {
+                        x = 1;                                                  // only the sticky bit is left
+                    } else {
+                        T mask = (T(1) << shift) - 1;
+                        x = (x >> shift) | T((x & mask) != 0);
+                    }
                     exp = 0;
-                } else if ( exp >= int32_t(_exp_mask) ) {
+                } else if ( exp >= int32_t(fmt_exp_mask()) ) {
                     // infinity
-                    exp = _exp_mask;
+                    exp = fmt_exp_mask();
                     x = 0;
                 }
                 break;
 
             case EXP_CLASS::INFINITE:
-                exp = _exp_mask;
+                exp = fmt_exp_mask();
                 x = 0;
                 break;
          
             case EXP_CLASS::NOT_A_NUMBER:
-                exp = _exp_mask;
+                exp = fmt_exp_mask();
                 if ( x == 0 ) x = 1;                                            // to distinguish from INF
                 break;
 
@@ -4208,8 +8088,8 @@ inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_e
                 cassert( false, "reconstruct() encountered a bad x_exp_class" );
                 break;
         }
-        x |= T(sign) << (_exp_w+_frac_guard_w);
-        x |= T(exp)  << (       _frac_guard_w);
+        x |= T(sign) << (fmt_exp_w()+fmt_frac_guard_w());
+        x |= T(exp)  << (       fmt_frac_guard_w());
     } else {
         // FIXED
         //
@@ -4224,7 +8104,7 @@ inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_e
                 //-----------------------------------------------------
                 // Crap out if we overflow.
                 //-----------------------------------------------------
-                T sign_mask = (x < 0) ? (T(-1) << (_w - 1)) : 0;
+                T sign_mask = (x < 0) ? (T(-1) << (fmt_w() - 1)) : 0;
                 cassert( (x & sign_mask) == sign_mask, "scalbn() x overflowed even before shift, x_exp=" + std::to_string(x_exp) );
                 bool x_overflow = (x & sign_mask) != sign_mask;
                 x <<= x_exp; 
@@ -4245,8 +8125,8 @@ inline void Cordic<T,FLT>::reconstruct( T& x, EXP_CLASS x_exp_class, int32_t x_e
                               " x_exp_class=" + to_str(x_exp_class) << " x_exp=" << x_exp << " constructed_f=" << _to_flt(x, false) << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& y_sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& y_sign ) const
 {
     if ( debug ) std::cout << "reduce_add_args: x_orig=" << _to_flt(x) << " y_orig=" << _to_flt(y) << "\n";
     deconstruct( x, x_exp_class, x_exp, x_sign );
@@ -4255,15 +8135,15 @@ inline void Cordic<T,FLT>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class,
          x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::INFINITE || x_exp_class == EXP_CLASS::NOT_A_NUMBER ||
          y_exp_class == EXP_CLASS::ZERO || y_exp_class == EXP_CLASS::INFINITE || y_exp_class == EXP_CLASS::NOT_A_NUMBER ) return;
    
-    // rshift fraction with smaller exponent
+    // rshift fraction with smaller exponent; past the guard bits it's all sticky
     if ( x_exp > y_exp ) {
-        uint32_t rs = x_exp - y_exp;
+        uint32_t rs = std::min( x_exp - y_exp, int32_t(fmt_frac_guard_w()) + 2 );
         bool set_sticky = (y & ((T(1) << rs)-1)) != 0;
         y >>= rs;
         if ( set_sticky ) y |= 1;
         y_exp = x_exp;
     } else {
-        uint32_t rs = y_exp - x_exp;
+        uint32_t rs = std::min( y_exp - x_exp, int32_t(fmt_frac_guard_w()) + 2 );
         bool set_sticky = (x & ((T(1) << rs)-1)) != 0;
         x >>= rs;
         if ( set_sticky ) x |= 1;
@@ -4271,8 +8151,8 @@ inline void Cordic<T,FLT>::reduce_add_args( T& x, T& y, EXP_CLASS& x_exp_class,
     }
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_mul_div_args( bool is_mul, T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_mul_div_args( bool is_mul, T& x, T& y, EXP_CLASS& x_exp_class, int32_t& x_exp, EXP_CLASS& y_exp_class, int32_t& y_exp, bool& sign ) const
 {
     if ( debug ) std::cout << "reduce_mul_div_args: is_mul=" << is_mul << " x_orig=" << _to_flt(x) << " y_orig=" << _to_flt(y) << "\n";
     bool x_sign;
@@ -4282,8 +8162,36 @@ inline void Cordic<T,FLT>::reduce_mul_div_args( bool is_mul, T& x, T& y, EXP_CLA
     sign = x_sign ^ y_sign;
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_r_arg( const T * _r, T& r, EXP_CLASS& r_exp_class, int32_t& r_exp, bool& r_sign ) const
+{
+    //-----------------------------------------------------
+    // For the optional r multiplier of sincos() and sinhcosh().
+    // Leave r's mantissa in fixed-point, 1 <= r < 2, so that it can be folded into
+    // the rotation's starting vector.  If _r is nullptr, r is 1.
+    //-----------------------------------------------------
+    if ( _r == nullptr ) {
+        r           = _one_fxd;
+        r_exp_class = EXP_CLASS::NORMAL;
+        r_exp       = 0;
+        r_sign      = false;
+        return;
+    }
+
+    r = *_r;
+    deconstruct( r, r_exp_class, r_exp, r_sign );
+    if ( r_exp_class == EXP_CLASS::SUBNORMAL ) {
+        int32_t shift = clz( r ) - _one_fxd_clz;
+        r    <<= shift;
+        r_exp -= shift;
+        r_exp_class = EXP_CLASS::NORMAL;
+    }
+    if ( debug ) std::cout << "reduce_r_arg: r_orig=" << _to_flt(*_r) << " r_reduced=" << _to_flt(r, false, true) <<
+                              " r_exp_class=" << to_str(r_exp_class) << " r_exp=" << r_exp << " r_sign=" << r_sign << "\n";
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign ) const
 {
     //-----------------------------------------------------
     // Identities:
@@ -4298,6 +8206,13 @@ inline void Cordic<T,FLT>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_
     T x_orig = x;
     deconstruct( x, x_exp_class, x_exp, x_sign );
     if ( debug ) std::cout << "reduce_sqrt_arg mid: x=" << _to_flt(x, false) << " x_exp=" << x_exp << "\n";
+    if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+        // normalize
+        int32_t shift = clz( x ) - _one_fxd_clz;
+        x <<= shift;
+        x_exp -= shift;
+        x_exp_class = EXP_CLASS::NORMAL;
+    }
     if ( x_exp_class == EXP_CLASS::NORMAL ) {
         x = (x >> 1) | (x & 1);
         x_exp++;
@@ -4312,8 +8227,75 @@ inline void Cordic<T,FLT>::reduce_sqrt_arg( T& x, EXP_CLASS& x_exp_class, int32_
                               " x_exp_class=" << to_str(x_exp_class) << " x_exp=" << x_exp << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_cbrt_arg( bool is_rcbrt, T& x, EXP_CLASS& x_exp_class, int32_t& x_exp, bool& x_sign, T& scale ) const
+{
+    //-----------------------------------------------------
+    // Strategy:
+    //     Factor x=m*2^e where 1 <= m < 2.
+    //     Split e (or -e for rcbrt) into 3k+j where j is 0..2,
+    //     and return k as the exp and 2^(j/3) as the scale.
+    //-----------------------------------------------------
+    T x_orig = x;
+    deconstruct( x, x_exp_class, x_exp, x_sign );
+    scale = _one_fxd;
+    if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+        // normalize
+        int32_t shift = clz( x ) - _one_fxd_clz;
+        x <<= shift;
+        x_exp -= shift;
+        x_exp_class = EXP_CLASS::NORMAL;
+    }
+    if ( x_exp_class == EXP_CLASS::NORMAL ) {
+        int32_t e = is_rcbrt ? -x_exp : x_exp;
+        x_exp = (e >= 0) ? (e / 3) : -((2 - e) / 3);                  // floor(e/3)
+        scale = _cbrt_fxd[e - 3*x_exp];
+    }
+    if ( debug ) std::cout << "reduce_cbrt_arg: x_orig=" << _to_flt(x_orig) << " x_reduced=m=" << _to_flt(x, false, true) <<
+                              " x_exp_class=" << to_str(x_exp_class) << " x_exp=" << x_exp << " scale=" << _to_flt(scale, false, true) << "\n";
+}
+
+template< typename T, typename FLT, typename CORE >
+inline const typename Cordic<T,FLT,CORE>::BASE_CONSTS& Cordic<T,FLT,CORE>::base_consts( FLT b, BASE_CONSTS& scratch ) const
+{
+    //-----------------------------------------------------
+    // Entries below _base_other_cnt are never written again, so they can be read
+    // without the lock.  Adding one takes the lock.  Once the table is full, the
+    // constants and their mulc() plans go into the caller's scratch, which is still
+    // cheaper than log().
+    //-----------------------------------------------------
+    if ( b == _base_e.b  ) return _base_e;
+    if ( b == _base_10.b ) return _base_10;
+    uint32_t cnt = _base_other_cnt.load( std::memory_order_acquire );
+    for( uint32_t k = 0; k < cnt; k++ )
+    {
+        if ( _base_other[k].b == b ) return _base_other[k];
+    }
+
+    BASE_CONSTS * c = &scratch;
+    std::unique_lock<std::mutex> lock( _base_other_mutex, std::defer_lock );
+    if ( cnt < BASE_OTHER_CNT ) {
+        lock.lock();
+        cnt = _base_other_cnt.load( std::memory_order_relaxed );
+        for( uint32_t k = 0; k < cnt; k++ )
+        {
+            if ( _base_other[k].b == b ) return _base_other[k];
+        }
+        if ( cnt < BASE_OTHER_CNT ) c = &_base_other[cnt];
+    }
+    c->b                  = b;
+    c->log2_b             = to_t( std::log2( b ), false );
+    c->one_div_log_b      = to_t( FLT(1) / std::log( b ), false );
+    c->log2_b_plan        = &c->plan[0];
+    c->one_div_log_b_plan = &c->plan[1];
+    mulc_plan_build( c->plan[0], c->log2_b );
+    mulc_plan_build( c->plan[1], c->one_div_log_b );
+    if ( c != &scratch ) _base_other_cnt.store( cnt+1, std::memory_order_release );
+    return *c;
+}
+
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x_exp_class, bool& x_sign ) const
 {
     //-----------------------------------------------------
     // Identities:
@@ -4336,8 +8318,46 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
         return;
     }
 
-    T log2_b = to_t( std::log2( b ), false );
-    x = mulc( x, log2_b, false );
+    if ( b == FLT(2) && _is_float ) {
+        //-----------------------------------------------------
+        // For exp2(), split x into i and f directly from its exponent.
+        // Then the only multiply is f*log(2) in fixed-point.
+        //-----------------------------------------------------
+        int32_t x_exp;
+        deconstruct( x, x_exp_class, x_exp, x_sign );
+        T f;
+        if ( x_exp > 30 ) {
+            // too big for any exponent, so saturate
+            i = int32_t(_exp_bias) + int32_t(_frac_guard_w) + 4;
+            f = 0;
+        } else if ( x_exp >= int32_t(_frac_guard_w) ) {
+            i = int32_t( x << (x_exp - int32_t(_frac_guard_w)) );
+            f = 0;
+        } else if ( x_exp >= 0 ) {
+            i = int32_t( x >> (int32_t(_frac_guard_w) - x_exp) );
+            f = (x << x_exp) & _frac_guard_mask;
+        } else {
+            i = 0;
+            f = (-x_exp <= int32_t(_frac_guard_w)) ? (x >> -x_exp) : T(0);
+        }
+        if ( x_sign ) {
+            i = -i;
+            if ( f != 0 ) {
+                i--;
+                f = _one_fxd - f;
+            }
+        }
+        x = mul_fxd( f, _log2_fxd );
+        x_exp_class = (x == 0) ? EXP_CLASS::ZERO : EXP_CLASS::NORMAL;
+        x_sign = false;
+        if ( debug ) std::cout << "reduce_exp_arg end: b=2 x_orig=" << _to_flt(x_orig) << " i=" << i <<
+                                  " x_reduced=log(2)*f=" << _to_flt(x, false, true) << "\n";
+        return;
+    }
+
+    BASE_CONSTS scratch;
+    const BASE_CONSTS& bc = base_consts( b, scratch );
+    x = mulc( x, bc.log2_b, bc.log2_b_plan, false );
 
     // get integer and fraction parts, still encoded;
     // convert encoded ii to int32_t;
@@ -4350,7 +8370,7 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
     }
     if ( debug ) std::cout << "reduce_exp_arg mid1: x=" << _to_flt(x) << " f=" << _to_flt(f) << " ii=" << _to_flt(ii) << "\n";
     i = _to_flt( ii );
-    x = mulc( f, _log2, false );
+    x = mulc( f, MULC::log2, false );
     if ( debug ) std::cout << "reduce_exp_arg mid2: f*log2=" << _to_flt(x) << "\n";
 
     int32_t x_exp;
@@ -4368,36 +8388,36 @@ inline void Cordic<T,FLT>::reduce_exp_arg( FLT b, T& x, int32_t& i, EXP_CLASS& x
                               " x_reduced=log(2)*f=" << _to_flt(x, false, true) << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_log_arg( T& x, EXP_CLASS& x_exp_class, bool& x_sign, T& addend ) const
 {
     //-----------------------------------------------------
     // log(x*y)         = log(x) + log(y)
     // log(b^i)         = i*log(b)
     // log(2^i + f)     = i*log(2) + log(f)                     i=integer f=remainder
     // 
-    // Normalize x so that it's in 1.00 .. 2.00.
-    // Then addend = i*log(2).
+    // Normalize x so that it's in 1.00 .. 2.00 and leave it deconstructed (fixed-point).
+    // Then addend = (i+1)*log(2), so that log(x_orig) = log(x/2) + addend.
     //-----------------------------------------------------
     T x_orig = x;
     int32_t x_exp;
     deconstruct( x, x_exp_class, x_exp, x_sign );
     if ( x_exp_class == EXP_CLASS::ZERO || x_exp_class == EXP_CLASS::NOT_A_NUMBER || x_exp_class == EXP_CLASS::INFINITE ) return;
 
-    if ( x_exp_class == EXP_CLASS::NORMAL ) {
-        x_exp++;
-        x = (x >> 1) | (x & 1);
-        if ( debug ) std::cout << "reduce_log_mid: x_shifted=0x" << std::hex << x << std::dec << "\n";
+    if ( x_exp_class == EXP_CLASS::SUBNORMAL ) {
+        int32_t shift = clz( x ) - _one_fxd_clz;
+        x    <<= shift;
+        x_exp -= shift;
+        x_exp_class = EXP_CLASS::NORMAL;
     }
-    addend = to_t( FLT(x_exp) * std::log(2) );
-    reconstruct( x, x_exp_class, 0, false );
-    if ( debug ) std::cout << "reduce_log_arg: x_orig=" << _to_flt(x_orig) << " x_reduced=" << _to_flt(x, false) <<
+    addend = to_t( FLT(x_exp+1) * std::log(2) );
+    if ( debug ) std::cout << "reduce_log_arg: x_orig=" << _to_flt(x_orig) << " x_reduced=" << _to_flt(x, false, true) <<
                                              " (0x" << std::hex << x << ")" << std::dec <<
                                              " addend=" << _to_flt(addend, false) << "\n";
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class, int32_t& exp, bool& swapped ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class, int32_t& exp, bool& swapped ) const
 {
     //-----------------------------------------------------
     // Must shift both x and y by max( x_exp, y_exp ).
@@ -4487,8 +8507,8 @@ inline void Cordic<T,FLT>::reduce_hypot_args( T& x, T& y, EXP_CLASS& exp_class,
     }
 }
 
-template< typename T, typename FLT >
-inline void Cordic<T,FLT>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& quad, EXP_CLASS& exp_class, bool& sign, bool& did_minus_pi_div_4 ) const
+template< typename T, typename FLT, typename CORE >
+inline void Cordic<T,FLT,CORE>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& quad, EXP_CLASS& exp_class, bool& sign, bool& did_minus_pi_div_4 ) const
 {
     //-----------------------------------------------------
     // Quick check for special values.
@@ -4524,13 +8544,23 @@ inline void Cordic<T,FLT>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& qua
             const T a_orig = a;
             sign = signbit( a );
             if ( sign ) a = neg( a, false );
+            uint64_t ii;
+            if ( reduce_sincos_arg_int( times_pi, a, ii ) ) {
+                quad = (ii >> 1) & 3;
+                did_minus_pi_div_4 = ii & 1;
+                if ( debug ) std::cout << "reduce_sincos_arg: times_pi=" << times_pi << " a_orig=" << _to_flt(a_orig) <<
+                                          " ii=" << ii << " a_reduced=" << _to_flt(a, false, true) <<
+                                          " quadrant=" << quad << " did_minus_pi_div_4=" << did_minus_pi_div_4 << "\n";
+                break;
+            }
+
             T m;
             T aa = 0;
             T i;
             if ( !times_pi ) {
-                m = mulc( a, _four_div_pi, false );
+                m = mulc( a, MULC::four_div_pi, false );
                 (void)modf( m, &i );
-                aa = mulc( i, _pi_div_4, false );
+                aa = mulc( i, MULC::pi_div_4, false );
                 a = sub( a, aa, false );
                 if ( debug ) std::cout << "reduce_sincos_arg mid: a_orig=" << _to_flt(a_orig) <<
                                           " aa_f=" << _to_flt(aa) << " aa=0x" << std::hex << aa << std::dec << 
@@ -4538,19 +8568,20 @@ inline void Cordic<T,FLT>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& qua
             } else {
                 m = scalbn( a, -2, false );  // divide by 4
                 m = modf( m, &i );
-                a = mulc( m, _four_div_pi, false );
+                a = mulc( m, MULC::four_div_pi, false );
             }
             EXP_CLASS a_exp_class;
             int32_t   a_exp;
             bool      a_sign;
             deconstruct( a, a_exp_class, a_exp, a_sign );
-            while( a_exp < 0 ) 
-            {
-                a = (a >> 1) | (a & 1);
-                a_exp++;
+            if ( a_exp < 0 ) {
+                // shifting out all fgw+1 bits leaves only the sticky bit
+                int32_t shift = std::min( -a_exp, int32_t(_frac_guard_w) + 1 );
+                a = (a >> shift) | T((a & ((T(1) << shift) - 1)) != 0);
+                a_exp = 0;
             }
 
-            T ii = _to_flt( i ); 
+            ii = _to_flt( i );
             quad = (ii >> 1) & 3;
             did_minus_pi_div_4 = ii & 1;
 
@@ -4564,6 +8595,78 @@ inline void Cordic<T,FLT>::reduce_sincos_arg( bool times_pi, T& a, uint32_t& qua
     }
 }
 
+template< typename T, typename FLT, typename CORE >
+inline bool Cordic<T,FLT,CORE>::reduce_sincos_arg_int( bool times_pi, T& a, uint64_t& i ) const
+{
+    //-----------------------------------------------------
+    // Payne-Hanek reduction of a positive, normal a in pure integer arithmetic.
+    //
+    // a = m * 2^s with m an integer of fgw+1 bits.  Only the bits of 4/PI from 2^(2-s) down
+    // can affect a*4/PI mod 8, so one 128-bit window of 4/PI starting there and one widening
+    // multiply give the octant i mod 8 and 64 exact bits of the fraction f.  Bits of 4/PI
+    // past the window contribute less than 2^(fgw-125).  For times_pi, a*4 is exact already.
+    // Then a = f*PI/4 in fixed-point.
+    //
+    // Returns false if this T or format has no table, and the caller uses mulc().
+    //-----------------------------------------------------
+    if constexpr ( std::is_integral<T>::value && sizeof( T ) <= 8 ) {
+        if ( _four_div_pi_bits == nullptr ) return false;
+
+        __extension__ typedef unsigned __int128 U2;
+        EXP_CLASS a_exp_class;
+        int32_t   a_exp;
+        bool      a_sign;
+        deconstruct( a, a_exp_class, a_exp, a_sign );
+        if ( !times_pi && a_exp < -1 ) {
+            // a < 1/2 < PI/4
+            int32_t shift = std::min( -a_exp, int32_t(_frac_guard_w) + 1 );
+            a = (a >> shift) | T((a & ((T(1) << shift) - 1)) != 0);    // record sticky bit
+            i = 0;
+            return true;
+        }
+
+        const uint64_t m = a;
+        const int32_t  s = a_exp - int32_t(_frac_guard_w);
+        uint64_t f;                                                     // 0.64 fraction
+        if ( times_pi ) {
+            const int32_t b = -(s + 2);                                 // fraction bits in a*4
+            if ( b <= -3 ) {
+                i = 0;
+                f = 0;
+            } else if ( b <= 0 ) {
+                i = (m << -b) & 7;
+                f = 0;
+            } else {
+                i = (b < 64) ? ((m >> b) & 7) : 0;
+                f = (b <= 64) ? (m << (64 - b)) : (b < 128) ? (m >> (b - 64)) : 0;
+            }
+        } else {
+            const int32_t    j0   = std::max( s - 2, 0 );
+            const uint32_t   sh   = j0 % 64;
+            const uint64_t * bits = _four_div_pi_bits + j0/64;
+            const uint64_t   w_hi = (sh == 0) ? bits[0] : ((bits[0] << sh) | (bits[1] >> (64 - sh)));
+            const uint64_t   w_lo = (sh == 0) ? bits[1] : ((bits[1] << sh) | (bits[2] >> (64 - sh)));
+
+            // q = m * window is 192 bits with b fraction bits, 125 <= b <= 190
+            const U2       p_lo = U2( m ) * w_lo;
+            const U2       q_hi = U2( m ) * w_hi + (p_lo >> 64);
+            const uint64_t q_lo = uint64_t( p_lo );
+            const int32_t  b    = j0 + 127 - s;
+            i = uint64_t( q_hi >> (b - 64) ) & 7;
+            f = (b >= 128) ? uint64_t( q_hi >> (b - 128) ) : (uint64_t( q_hi << (128 - b) ) | (q_lo >> (b - 64)));
+        }
+
+        const U2 p = U2( f ) * PI_DIV_4_U64;
+        a = T( (p + (U2( 1 ) << (127 - _frac_guard_w))) >> (128 - _frac_guard_w) );
+        return true;
+    } else {
+        (void)times_pi;
+        (void)a;
+        (void)i;
+        return false;
+    }
+}
+
 template class Cordic<int64_t, double>;
 
 #endif
@@ -0,0 +1,505 @@
+// Copyright (c) 2014-2019 Robert A. Alfieri
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// StaticCordic.h - Cordic with the number format fixed at compile time
+//
+// Cordic picks its widths at run time, so every CORDIC iteration loop has a
+// run-time trip count and reads its atan/atanh constants from heap tables.
+// When the format is known up front, StaticCordicCore makes the widths, masks,
+// bias, iteration count, and atan/atanh tables constexpr and supplies the
+// iterations of the core CORDIC routines unrolled at compile time (each
+// iteration's shift amount and table constant become immediates).
+//
+// StaticCordic is a Cordic with StaticCordicCore as its CORE, so Cordic calls the
+// unrolled iterations directly, with no virtual calls, and its deconstruct(),
+// reconstruct(), and add() see the format as constants.  The math functions
+// and logging are the same as Cordic's:
+//
+//     StaticCordic<8, 23> c;                      // 1.8.23 floating-point
+//     T r = c.sin( c.to_t( 0.5 ) );
+//
+// Because it is a different type from Cordic<T,FLT>, it can't be used with freal.
+// T must be a built-in integer type because the tables are computed at compile time.
+//
+#ifndef _StaticCordic_h
+#define _StaticCordic_h
+
+#include <type_traits>
+#include <utility>
+
+#include "Cordic.h"
+
+//-----------------------------------------------------
+// Compile-Time Tables
+//
+// atan(2^-i) and atanh(2^-i) are computed using their Taylor series in long double,
+// which converge quickly enough for 2^-i <= 1/2.  atan(1) is just PI/4.
+// The hyperbolic iterations run i=1..n with 4, 13, 40, ... repeated,
+// so that schedule is also computed once here.
+//-----------------------------------------------------
+static constexpr uint32_t static_cordic_ceil_log2( uint32_t x )
+{
+    uint32_t l = 0;
+    while( (uint32_t(1) << l) < x ) l++;
+    return l;
+}
+
+static constexpr uint32_t static_cordic_hyperbolic_cnt( uint32_t n )
+{
+    uint32_t cnt = 0;
+    uint32_t next_dup_i = 4;
+    for( uint32_t i = 1; i <= n; i++ )
+    {
+        cnt++;
+        if ( i == next_dup_i ) {
+            next_dup_i = 3*i + 1;
+            cnt++;
+        }
+    }
+    return cnt;
+}
+
+template< typename T, uint32_t FRAC_GUARD_W, uint32_t N >
+struct StaticCordicTables
+{
+    static constexpr uint32_t hyperbolic_cnt = static_cordic_hyperbolic_cnt( N );
+
+    T        circular_atan_fxd[N+1];                // atan(2^-i)
+    T        hyperbolic_atanh_fxd[N+1];             // atanh(2^-i), [0] is unused (-1)
+    uint32_t hyperbolic_i[hyperbolic_cnt+1];        // i for each hyperbolic iteration
+    T        circular_angle_max_fxd;                // circular vectoring |z0| max value
+    T        hyperbolic_angle_max_fxd;              // hyperbolic vectoring |z0| max value
+
+    static constexpr T to_fxd( long double x )      // round-to-nearest like Cordic::to_t( x, false, true )
+    {
+        bool sign = x < 0.0L;
+        if ( sign ) x = -x;
+        T x_t = T( x * static_cast<long double>( T(1) << FRAC_GUARD_W ) + 0.5L );
+        return sign ? -x_t : x_t;
+    }
+
+    static constexpr StaticCordicTables make( void )
+    {
+        StaticCordicTables t = {};
+        long double pow2 = 1.0L;
+        for( uint32_t i = 0; i <= N; i++, pow2 /= 2.0L )
+        {
+            long double a  = 0.0L;
+            long double ah = 0.0L;
+            if ( i == 0 ) {
+                a  = 0.785398163397448309615660845819875721L;
+                ah = -1.0L;
+            } else {
+                long double x2   = pow2 * pow2;
+                long double term = pow2;
+                for( uint32_t k = 1; term > 1e-40L; k += 2, term *= x2 )
+                {
+                    long double tk = term / static_cast<long double>( k );
+                    a  += ((k & 2) == 0) ? tk : -tk;
+                    ah += tk;
+                }
+            }
+            t.circular_atan_fxd[i]    = to_fxd( a );
+            t.hyperbolic_atanh_fxd[i] = to_fxd( ah );
+        }
+
+        uint32_t k = 0;
+        uint32_t next_dup_i = 4;
+        for( uint32_t i = 1; i <= N; i++ )
+        {
+            t.hyperbolic_i[k++] = i;
+            t.hyperbolic_angle_max_fxd += t.hyperbolic_atanh_fxd[i];
+            if ( i == next_dup_i ) {
+                next_dup_i = 3*i + 1;
+                t.hyperbolic_i[k++] = i;
+                t.hyperbolic_angle_max_fxd += t.hyperbolic_atanh_fxd[i];
+            }
+        }
+        t.hyperbolic_i[k] = 0;
+        t.circular_angle_max_fxd = t.circular_atan_fxd[0];
+        return t;
+    }
+};
+
+template< uint32_t INT_EXP_W,                   // fixed-point integer width  OR floating-point exponent width
+          uint32_t FRAC_W,                      // fixed-point fraction width OR floating-point mantissa width
+          bool     IS_FLOAT,                    // true=floating-point, false=fixed-point
+          uint32_t GUARD_W,                     // number of guard bits used for CORDIC proper (-1 == default == log2(frac_w))
+          uint32_t N,                           // number of iterations used for CORDIC proper (-1 == default == frac_w)
+          typename T >
+struct StaticCordicCore
+{
+    //-----------------------------------------------------
+    // Compile-Time Format
+    //-----------------------------------------------------
+    static constexpr bool     is_static          = true;
+    static constexpr bool     is_float_c         = IS_FLOAT;
+    static constexpr uint32_t int_w_c            = IS_FLOAT ? 0 : INT_EXP_W;
+    static constexpr uint32_t exp_w_c            = IS_FLOAT ? INT_EXP_W : 0;
+    static constexpr uint32_t frac_w_c           = FRAC_W;
+    static constexpr uint32_t guard_w_c          = (GUARD_W == uint32_t(-1)) ? static_cordic_ceil_log2( FRAC_W ) : GUARD_W;
+    static constexpr uint32_t frac_guard_w_c     = FRAC_W + guard_w_c;
+    static constexpr uint32_t w_c                = 1 + INT_EXP_W + frac_guard_w_c;
+    static constexpr uint32_t n_c                = (N == uint32_t(-1)) ? (1 + FRAC_W) : N;
+    static constexpr T        frac_guard_mask_c  = (T(1) << frac_guard_w_c) - 1;
+    static constexpr T        guard_mask_c       = (T(1) << guard_w_c) - 1;
+    static constexpr uint32_t exp_mask_c         = IS_FLOAT ? ((uint32_t(1) << INT_EXP_W)-1) : 0;
+    static constexpr int32_t  exp_bias_c         = IS_FLOAT ? ((exp_mask_c >> 1) - 1) : 0;
+    static constexpr int32_t  exp_unbiased_min_c = IS_FLOAT ? (1 - exp_bias_c) : 0;
+    static constexpr int32_t  exp_unbiased_max_c = IS_FLOAT ? ((1 << (INT_EXP_W-1))-1) : 0;
+
+    static constexpr T        one_fxd_c          = T(1) << frac_guard_w_c;
+    static constexpr int32_t  one_fxd_clz_c      = int32_t(8*sizeof(T)) - 1 - int32_t(frac_guard_w_c);   // same as Cordic::clz( one_fxd )
+    static constexpr T        two_fxd_c          = T(2) << frac_guard_w_c;
+    static constexpr T        four_fxd_c         = T(4) << frac_guard_w_c;
+    static constexpr T        min_fxd_c          = T(1) << guard_w_c;
+    static constexpr T        quiet_NaN_fxd_c    = T(1) << (frac_guard_w_c-1);
+
+    static_assert( std::is_integral<T>::value, "StaticCordic T must be a built-in integer type" );
+    static_assert( INT_EXP_W != 0, "INT_EXP_W must be > 0" );
+    static_assert( FRAC_W != 0, "FRAC_W must be > 0" );
+    static_assert( w_c <= (sizeof( T ) * 8), "1 + INT_EXP_W + FRAC_W + GUARD_W does not fit in T container" );
+
+    //-----------------------------------------------------
+    // Compile-Time Tables
+    //-----------------------------------------------------
+    using Tables = StaticCordicTables<T, frac_guard_w_c, n_c>;
+    static constexpr uint32_t hyperbolic_cnt_c = Tables::hyperbolic_cnt;
+    static constexpr Tables   tables           = Tables::make();
+
+    //-----------------------------------------------------
+    // The iterations of the basic CORDIC functions, unrolled.
+    // x, y, z hold x0, y0, z0 on entry; Cordic has already checked their ranges.
+    //-----------------------------------------------------
+    static void circular_rotation(       T& x, T& y, T& z );
+    static void circular_vectoring(      T& x, T& y, T& z );
+    static void circular_vectoring_xy(   T& x, T& y       );
+    static void hyperbolic_rotation(     T& x, T& y, T& z );
+    static void hyperbolic_vectoring(    T& x, T& y, T& z );
+    static void hyperbolic_vectoring_xy( T& x, T& y       );
+    static void linear_rotation(         T& x, T& y, T& z );
+    static void linear_vectoring(        T& x, T& y, T& z );
+
+private:
+    template< size_t... I > static void circular_rotation_steps(      T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void circular_vectoring_steps(     T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void circular_vectoring_xy_steps(  T& x, T& y,       std::index_sequence<I...> );
+    template< size_t... I > static void hyperbolic_rotation_steps(    T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void hyperbolic_vectoring_steps(   T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void hyperbolic_vectoring_xy_steps(T& x, T& y,       std::index_sequence<I...> );
+    template< size_t... I > static void linear_rotation_steps(        T& x, T& y, T& z, std::index_sequence<I...> );
+    template< size_t... I > static void linear_vectoring_steps(       T& x, T& y, T& z, std::index_sequence<I...> );
+
+    template< uint32_t I > static void circular_rotation_step(        T& x, T& y, T& z );
+    template< uint32_t I > static void circular_vectoring_step(       T& x, T& y, T& z );
+    template< uint32_t I > static void circular_vectoring_xy_step(    T& x, T& y       );
+    template< uint32_t I > static void hyperbolic_rotation_step(      T& x, T& y, T& z );
+    template< uint32_t I > static void hyperbolic_vectoring_step(     T& x, T& y, T& z );
+    template< uint32_t I > static void hyperbolic_vectoring_xy_step(  T& x, T& y       );
+    template< uint32_t I > static void linear_rotation_step(          T& x, T& y, T& z );
+    template< uint32_t I > static void linear_vectoring_step(         T& x, T& y, T& z );
+};
+
+template< uint32_t INT_EXP_W,                   // fixed-point integer width  OR floating-point exponent width
+          uint32_t FRAC_W,                      // fixed-point fraction width OR floating-point mantissa width
+          bool     IS_FLOAT=true,               // true=floating-point, false=fixed-point
+          uint32_t GUARD_W=uint32_t(-1),        // number of guard bits used for CORDIC proper (-1 == default == log2(frac_w))
+          uint32_t N=uint32_t(-1),              // number of iterations used for CORDIC proper (-1 == default == frac_w)
+          typename T=int64_t,
+          typename FLT=double >
+class StaticCordic : public Cordic<T,FLT,StaticCordicCore<INT_EXP_W,FRAC_W,IS_FLOAT,GUARD_W,N,T>>
+{
+public:
+    using Core = StaticCordicCore<INT_EXP_W,FRAC_W,IS_FLOAT,GUARD_W,N,T>;
+
+    StaticCordic( void ) : Cordic<T,FLT,Core>( INT_EXP_W, FRAC_W, IS_FLOAT, Core::guard_w_c, Core::n_c ) {}
+};
+
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//
+//
+//  ___                 _                           _        _   _
+// |_ _|_ __ ___  _ __ | | ___ _ __ ___   ___ _ __ | |_ __ _| |_(_) ___  _ __
+//  | || '_ ` _ \| '_ \| |/ _ \ '_ ` _ \ / _ \ '_ \| __/ _` | __| |/ _ \| '_ \
+//  | || | | | | | |_) | |  __/ | | | | |  __/ | | | || (_| | |_| | (_) | | | |
+// |___|_| |_| |_| .__/|_|\___|_| |_| |_|\___|_| |_|\__\__,_|\__|_|\___/|_| |_|
+//               |_|
+//
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+//-----------------------------------------------------
+
+#define _SCDECL template< uint32_t INT_EXP_W, uint32_t FRAC_W, bool IS_FLOAT, uint32_t GUARD_W, uint32_t N, typename T >
+#define _SC     StaticCordicCore<INT_EXP_W,FRAC_W,IS_FLOAT,GUARD_W,N,T>
+
+//-----------------------------------------------------
+// The CORDIC Functions
+//
+// Each one expands into one call per iteration via std::index_sequence, so the
+// iteration index is a template parameter and the compiler sees straight-line code.
+//-----------------------------------------------------
+_SCDECL
+inline void _SC::circular_rotation( T& x, T& y, T& z )
+{
+    circular_rotation_steps( x, y, z, std::make_index_sequence<n_c+1>{} );
+}
+
+_SCDECL
+inline void _SC::circular_vectoring( T& x, T& y, T& z )
+{
+    circular_vectoring_steps( x, y, z, std::make_index_sequence<n_c+1>{} );
+}
+
+_SCDECL
+inline void _SC::circular_vectoring_xy( T& x, T& y )
+{
+    circular_vectoring_xy_steps( x, y, std::make_index_sequence<n_c+1>{} );
+}
+
+_SCDECL
+inline void _SC::hyperbolic_rotation( T& x, T& y, T& z )
+{
+    hyperbolic_rotation_steps( x, y, z, std::make_index_sequence<hyperbolic_cnt_c>{} );
+}
+
+_SCDECL
+inline void _SC::hyperbolic_vectoring( T& x, T& y, T& z )
+{
+    hyperbolic_vectoring_steps( x, y, z, std::make_index_sequence<hyperbolic_cnt_c>{} );
+}
+
+_SCDECL
+inline void _SC::hyperbolic_vectoring_xy( T& x, T& y )
+{
+    hyperbolic_vectoring_xy_steps( x, y, std::make_index_sequence<hyperbolic_cnt_c>{} );
+}
+
+_SCDECL
+inline void _SC::linear_rotation( T& x, T& y, T& z )
+{
+    linear_rotation_steps( x, y, z, std::make_index_sequence<n_c+1>{} );
+}
+
+_SCDECL
+inline void _SC::linear_vectoring( T& x, T& y, T& z )
+{
+    linear_vectoring_steps( x, y, z, std::make_index_sequence<n_c+1>{} );
+}
+
+//-----------------------------------------------------
+// Iteration Expanders
+//-----------------------------------------------------
+_SCDECL template< size_t... I >
+inline void _SC::circular_rotation_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( circular_rotation_step<I>( x, y, z ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::circular_vectoring_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( circular_vectoring_step<I>( x, y, z ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::circular_vectoring_xy_steps( T& x, T& y, std::index_sequence<I...> )
+{
+    ( circular_vectoring_xy_step<I>( x, y ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::hyperbolic_rotation_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( hyperbolic_rotation_step<tables.hyperbolic_i[I]>( x, y, z ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::hyperbolic_vectoring_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( hyperbolic_vectoring_step<tables.hyperbolic_i[I]>( x, y, z ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::hyperbolic_vectoring_xy_steps( T& x, T& y, std::index_sequence<I...> )
+{
+    ( hyperbolic_vectoring_xy_step<tables.hyperbolic_i[I]>( x, y ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::linear_rotation_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( linear_rotation_step<I>( x, y, z ), ... );
+}
+
+_SCDECL template< size_t... I >
+inline void _SC::linear_vectoring_steps( T& x, T& y, T& z, std::index_sequence<I...> )
+{
+    ( linear_vectoring_step<I>( x, y, z ), ... );
+}
+
+//-----------------------------------------------------
+// One Iteration Each
+//-----------------------------------------------------
+_SCDECL template< uint32_t I >
+inline void _SC::circular_rotation_step( T& x, T& y, T& z )
+{
+    constexpr T A = tables.circular_atan_fxd[I];
+    if ( debug ) printf( "circular_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y, z );
+    T xi;
+    if ( z >= 0 ) {
+        xi = x - (y >> I);
+        y  = y + (x >> I);
+        z  = z - A;
+    } else {
+        xi = x + (y >> I);
+        y  = y - (x >> I);
+        z  = z + A;
+    }
+    x = xi;
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::circular_vectoring_step( T& x, T& y, T& z )
+{
+    constexpr T A = tables.circular_atan_fxd[I];
+    if ( debug ) printf( "circular_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y, z );
+    T xi;
+    if ( y < 0 ) {
+        xi = x - (y >> I);
+        y  = y + (x >> I);
+        z  = z - A;
+    } else {
+        xi = x + (y >> I);
+        y  = y - (x >> I);
+        z  = z + A;
+    }
+    x = xi;
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::circular_vectoring_xy_step( T& x, T& y )
+{
+    if ( debug ) printf( "circular_vectoring_xy: i=%2d xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y );
+    T xi;
+    if ( y < 0 ) {
+        xi = x - (y >> I);
+        y  = y + (x >> I);
+    } else {
+        xi = x + (y >> I);
+        y  = y - (x >> I);
+    }
+    x = xi;
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::hyperbolic_rotation_step( T& x, T& y, T& z )
+{
+    constexpr T A = tables.hyperbolic_atanh_fxd[I];
+    if ( debug ) printf( "hyperbolic_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y, z );
+    T xi;
+    if ( z >= 0 ) {
+        xi = x + (y >> I);
+        y  = y + (x >> I);
+        z  = z - A;
+    } else {
+        xi = x - (y >> I);
+        y  = y - (x >> I);
+        z  = z + A;
+    }
+    x = xi;
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::hyperbolic_vectoring_step( T& x, T& y, T& z )
+{
+    constexpr T A = tables.hyperbolic_atanh_fxd[I];
+    if ( debug ) printf( "hyperbolic_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y, z );
+    T xi;
+    if ( y < 0 ) {
+        xi = x + (y >> I);
+        y  = y + (x >> I);
+        z  = z - A;
+    } else {
+        xi = x - (y >> I);
+        y  = y - (x >> I);
+        z  = z + A;
+    }
+    x = xi;
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::hyperbolic_vectoring_xy_step( T& x, T& y )
+{
+    if ( debug ) printf( "hyperbolic_vectoring_xy: i=%2d xy_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y );
+    T xi;
+    if ( y < 0 ) {
+        xi = x + (y >> I);
+        y  = y + (x >> I);
+    } else {
+        xi = x - (y >> I);
+        y  = y - (x >> I);
+    }
+    x = xi;
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::linear_rotation_step( T& x, T& y, T& z )
+{
+    constexpr T POW2 = one_fxd_c >> I;
+    if ( debug ) printf( "linear_rotation: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y, z );
+    if ( z >= 0 ) {
+        y = y + (x >> I);
+        z = z - POW2;
+    } else {
+        y = y - (x >> I);
+        z = z + POW2;
+    }
+}
+
+_SCDECL template< uint32_t I >
+inline void _SC::linear_vectoring_step( T& x, T& y, T& z )
+{
+    constexpr T POW2 = one_fxd_c >> I;
+    if ( debug ) printf( "linear_vectoring: i=%2d xyz_fxd=[0x%016" FMT_LLX ",0x%016" FMT_LLX ",0x%016" FMT_LLX "]\n", I, x, y, z );
+    if ( y < 0 ) {
+        y = y + (x >> I);
+        z = z - POW2;
+    } else {
+        y = y - (x >> I);
+        z = z + POW2;
+    }
+}
+
+#undef _SCDECL
+#undef _SC
+
+#endif
@@ -0,0 +1,266 @@
+// Copyright (c) 2014-2019 Robert A. Alfieri
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// ThreadPool.h - small work-stealing thread pool used by Cordic::parallel()
+//
+// Usage:
+//
+//     ThreadPool pool;                                 // one worker per hardware thread
+//     cordic.parallel( pool ).exp( in, out, n );       // see Cordic.h
+//
+//     pool.parallel_for( n, grain, []( size_t begin, size_t end ) { ... } );
+//
+// Each worker owns a deque of tasks.  A worker pops from the back of its own deque
+// and, when that is empty, steals from the front of the other deques.
+// The thread that calls parallel_for() also runs tasks until its job is done.
+//
+// parallel_for() does not allocate once the deques have grown to the number of chunks
+// in flight: fn is called through a plain function pointer rather than a std::function,
+// and each deque is a ring buffer that keeps its storage.
+//
+#ifndef _ThreadPool_h
+#define _ThreadPool_h
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+
+class ThreadPool
+{
+public:
+    ThreadPool( uint32_t thread_cnt=0 );        // 0 means std::thread::hardware_concurrency()
+    ~ThreadPool();
+
+    uint32_t thread_cnt( void ) const;          // number of worker threads
+
+    // Call fn( begin, end ) on chunks of [0, n) of at most grain elements each.
+    // Returns when all chunks are done.
+    //
+    template< typename FN >
+    void parallel_for( size_t n, size_t grain, const FN& fn );
+
+private:
+    struct Job
+    {
+        void                 (*call)( const void * fn, size_t begin, size_t end );
+        const void *            fn;
+        std::atomic<size_t>     remaining;                              // chunks not yet finished
+        std::mutex              mutex;
+        std::condition_variable done;
+    };
+
+    struct Task
+    {
+        Job *    job;
+        size_t   begin;
+        size_t   end;
+    };
+
+    struct Queue                                        // ring buffer of tasks
+    {
+        std::mutex        mutex;
+        std::vector<Task> tasks;                        // capacity, grown but never shrunk
+        size_t            head;                         // index of the front task
+        size_t            cnt;                          // number of tasks
+
+        void push_back( const Task& task );
+        Task pop_back( void );
+        Task pop_front( void );
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;         // one per worker, plus one for outside callers
+    std::vector<std::thread>            threads;
+    std::mutex                          wake_mutex;
+    std::condition_variable             wake;
+    std::atomic<size_t>                 queued;         // tasks sitting in queues
+    bool                                stopping;
+
+    bool pop( uint32_t self, Task& task );              // own back first, then steal others' front
+    void run( const Task& task );
+    void worker( uint32_t self );
+};
+
+//-----------------------------------------------------
+// Constructor/Destructor
+//-----------------------------------------------------
+inline ThreadPool::ThreadPool( uint32_t thread_cnt )
+{
+    if ( thread_cnt == 0 ) thread_cnt = std::thread::hardware_concurrency();
+    if ( thread_cnt == 0 ) thread_cnt = 1;
+    queued   = 0;
+    stopping = false;
+    for( uint32_t i = 0; i <= thread_cnt; i++ )
+    {
+        queues.push_back( std::unique_ptr<Queue>( new Queue ) );
+        queues.back()->tasks.resize( 16 );
+        queues.back()->head = 0;
+        queues.back()->cnt  = 0;
+    }
+    for( uint32_t i = 0; i < thread_cnt; i++ )
+    {
+        threads.push_back( std::thread( &ThreadPool::worker, this, i ) );
+    }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock( wake_mutex );
+        stopping = true;
+    }
+    wake.notify_all();
+    for( auto& t : threads ) t.join();
+}
+
+inline uint32_t ThreadPool::thread_cnt( void ) const
+{
+    return threads.size();
+}
+
+//-----------------------------------------------------
+// parallel_for
+//-----------------------------------------------------
+template< typename FN >
+inline void ThreadPool::parallel_for( size_t n, size_t grain, const FN& fn )
+{
+    if ( n == 0 ) return;
+    if ( grain == 0 ) grain = 1;
+    size_t chunk_cnt = (n + grain - 1) / grain;
+    if ( chunk_cnt == 1 ) {
+        fn( 0, n );
+        return;
+    }
+
+    //-----------------------------------------------------
+    // Deal the chunks out round-robin to the workers' deques.
+    // queued is bumped first so that it never undercounts.
+    //-----------------------------------------------------
+    Job job;
+    job.call      = []( const void * f, size_t begin, size_t end ) { (*static_cast<const FN *>( f ))( begin, end ); };
+    job.fn        = &fn;
+    job.remaining = chunk_cnt;
+    uint32_t worker_cnt = threads.size();
+    {
+        std::lock_guard<std::mutex> lock( wake_mutex );
+        queued += chunk_cnt;
+    }
+    for( size_t c = 0; c < chunk_cnt; c++ )
+    {
+        size_t begin = c * grain;
+        size_t end   = std::min( begin + grain, n );
+        Queue& q     = *queues[c % worker_cnt];
+        std::lock_guard<std::mutex> lock( q.mutex );
+        q.push_back( Task{ &job, begin, end } );
+    }
+    wake.notify_all();
+
+    //-----------------------------------------------------
+    // Help out until there's nothing left to steal, then wait for our job.
+    //-----------------------------------------------------
+    Task task;
+    while( job.remaining != 0 && pop( worker_cnt, task ) ) 
+    {
+        run( task );
+    }
+    std::unique_lock<std::mutex> lock( job.mutex );
+    job.done.wait( lock, [&]{ return job.remaining == 0; } );
+}
+
+//-----------------------------------------------------
+// Internals
+//-----------------------------------------------------
+inline bool ThreadPool::pop( uint32_t self, Task& task )
+{
+    uint32_t queue_cnt = queues.size();
+    for( uint32_t i = 0; i < queue_cnt; i++ )
+    {
+        uint32_t qi   = (self + i) % queue_cnt;
+        Queue&   q    = *queues[qi];
+        std::lock_guard<std::mutex> lock( q.mutex );
+        if ( q.cnt == 0 ) continue;
+        task = (i == 0) ? q.pop_back() : q.pop_front();
+        queued--;
+        return true;
+    }
+    return false;
+}
+
+inline void ThreadPool::run( const Task& task )
+{
+    //-----------------------------------------------------
+    // The job lives on the stack of its parallel_for() caller, so the last
+    // chunk must not touch it after releasing job->mutex.
+    //-----------------------------------------------------
+    Job * job = task.job;
+    job->call( job->fn, task.begin, task.end );
+    std::lock_guard<std::mutex> lock( job->mutex );
+    if ( --job->remaining == 0 ) job->done.notify_all();
+}
+
+inline void ThreadPool::Queue::push_back( const Task& task )
+{
+    if ( cnt == tasks.size() ) {
+        // full: unroll into a buffer twice as big
+        std::vector<Task> bigger( 2*tasks.size() );
+        for( size_t i = 0; i < cnt; i++ ) bigger[i] = tasks[(head + i) % tasks.size()];
+        tasks.swap( bigger );
+        head = 0;
+    }
+    tasks[(head + cnt) % tasks.size()] = task;
+    cnt++;
+}
+
+inline ThreadPool::Task ThreadPool::Queue::pop_back( void )
+{
+    cnt--;
+    return tasks[(head + cnt) % tasks.size()];
+}
+
+inline ThreadPool::Task ThreadPool::Queue::pop_front( void )
+{
+    Task task = tasks[head];
+    head = (head + 1) % tasks.size();
+    cnt--;
+    return task;
+}
+
+inline void ThreadPool::worker( uint32_t self )
+{
+    for( ;; )
+    {
+        Task task;
+        if ( pop( self, task ) ) {
+            run( task );
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock( wake_mutex );
+        wake.wait( lock, [&]{ return stopping || queued != 0; } );
+        if ( stopping && queued == 0 ) return;
+    }
+}
+
+#endif
@@ -310,6 +310,8 @@ public:
     freal  exp10( void ) const;              // 10^x
     freal  pow( const freal& e ) const;      // a^e
     freal  pow( const FLT&   e ) const;      // a^e
+    freal  pown( int n ) const;              // a^n
+    freal  rootn( int n ) const;             // a^(1/n)
     freal  log( void ) const;                // log base-e
     freal  log( const freal& b ) const;      // log base-b
     freal  log( const FLT&   b ) const;      // log base-b
@@ -603,6 +605,8 @@ decl_std2x(    expc,            FLT             )
 decl_std1(     exp2                             )
 decl_std1(     exp10                            )
 decl_std2(     pow                              )
+decl_std2x(    pown,            int             )
+decl_std2x(    rootn,           int             )
 decl_std1(     log                              )
 decl_std2(     log                              )
 decl_std1(     log1p                            )
@@ -1252,6 +1256,8 @@ decl_pop2x(     expc,           FLT                     )
 decl_pop1(      exp2                                    )
 decl_pop1(      exp10                                   )
 decl_pop2(      pow                                     )
+decl_pop2x(     pown,           int                     )
+decl_pop2x(     rootn,          int                     )
 decl_pop1(      log                                     )
 decl_pop2(      log                                     )
 decl_pop1(      log1p                                   )
@@ -53,6 +53,7 @@ public:
     
     // minimum set of operators needed by Cordic.h:
     bool   signbit     ( void ) const;
+    int    clz         ( void ) const;     // leading zero bits within int_w (0 if negative)
     mpint  neg         ( void ) const;
     mpint  operator -  () const;
     mpint& operator =  ( const mpint& b );
@@ -233,6 +234,21 @@ inline bool mpint::signbit( void ) const
     return bit( int_w-1 );
 }
 
+inline int mpint::clz( void ) const
+{
+    iassert( int_w > 0, "mpint is undefined" );
+    if ( signbit() ) return 0;
+
+    // scan a word at a time from the top; bits above int_w in the top word are sign bits (0)
+    size_t above_w = 64*word_cnt - int_w;
+    for( size_t i = word_cnt; i > 0; i-- )
+    {
+        uint64_t wi = (word_cnt == 1) ? u.w0 : u.w[i-1];
+        if ( wi != 0 ) return int( 64*(word_cnt-i) + __builtin_clzll( wi ) - above_w );
+    }
+    return int( int_w );
+}
+
 inline mpint mpint::to_mpint( std::string s, bool allow_no_conversion, int base, size_t * pos )
 {
     iassert( base == 10, "to_mpint() currently supports only base 10" );
@@ -21,6 +21,7 @@
 // test_basic.cpp - basic black-box test of freal.h math functions
 //
 #include "freal.h"                                      // not used yet, just here to test build
+#include "StaticCordic.h"
 #include "Analysis.h"
 #include "AnalysisLight.h"
 #include "mpint.h"
@@ -66,6 +67,19 @@ int main( int argc, const char * argv[] )
     }
     std::cout << "exp_or_int_w=" << exp_or_int_w << " frac_w=" << frac_w << " tol=" << TOL << "\n\n";
 
+    // max errors in ulps for check_ulps(), by function family, and the smallest x to pass to log() and friends
+    //
+    const FLT ULPS_MUL   = 1.0;
+    const FLT ULPS_SQRT  = 2.0;
+    const FLT ULPS_SIN   = 2.0;
+    const FLT ULPS_TAN   = 8.0;
+    const FLT ULPS_ASIN  = 8.0;
+    const FLT ULPS_EXP   = 4.0;
+    const FLT ULPS_LOG   = 6.0;
+    const FLT ULPS_ATANH = 3.0;
+    const FLT ULPS_POW   = 16.0;
+    const FLT TINY       = std::ldexp( 1.0, -frac_w );
+
     //---------------------------------------------------------------------------
     // Set up default freal type to use for implicit conversions.
     //---------------------------------------------------------------------------
@@ -210,6 +224,759 @@ int main( int argc, const char * argv[] )
     do_op2(     "34) pow",              pow,    std::pow,      1.000000204890966415405273437500, 1.000229761004447937011718750000*8.0 );
     do_op12(    "35) sincos",           sincos, sincos,        1.000000204890966415405273437500 );
 
+    //---------------------------------------------------------------------------
+    // StaticCordic must give bit-identical results to the same run-time format,
+    // including inside a Precision scope and in correctly-rounded mode.
+    // These formats are compiled in, so they don't depend on the command line.
+    //---------------------------------------------------------------------------
+    std::cout << "\nSTATIC FORMAT:\n";
+    auto static_check = []( auto& sc, Cordic<T,FLT>& dc, bool with_cr )
+    {
+        std::cout << "    " << sc.exp_w() << "." << sc.frac_w() << "\n";
+        for( int cr = 0; cr <= int(with_cr); cr++ )
+        {
+            sc.correctly_rounded_set( cr != 0 );
+            dc.correctly_rounded_set( cr != 0 );
+            for( FLT x : { 0.681807431807431031, 3.681807431807431031, -2.1, 0.001, 12.5 } )
+            {
+                T sx = sc.to_t( x );
+                T dx = dc.to_t( x );
+                #define do_static1( fn ) \
+                    cassert( sc.fn( sx ) == dc.fn( dx ), std::string( #fn ) + "(" + std::to_string( x ) + ") differs for StaticCordic<" + \
+                                                         std::to_string( sc.exp_w() ) + "," + std::to_string( sc.frac_w() ) + "> cr=" + std::to_string( cr ) );
+                do_static1( sin )
+                do_static1( cos )
+                do_static1( atan )
+                do_static1( exp )
+                do_static1( sinh )
+                do_static1( sqrt )
+                do_static1( rcp )
+                if ( x > 0.0 ) {
+                    do_static1( log )
+                }
+                #undef do_static1
+            }
+        }
+        sc.correctly_rounded_set( false );
+        dc.correctly_rounded_set( false );
+        for( FLT x : { 0.681807431807431031, -2.1, 12.5 } )
+        {
+            // inside a Precision scope the unrolled code must cut its iterations the same way
+            T ss, se, ds, de;
+            { auto p = sc.precision( 6 ); ss = sc.sin( sc.to_t( x ) ); se = sc.exp( sc.to_t( x ) ); }
+            { auto p = dc.precision( 6 ); ds = dc.sin( dc.to_t( x ) ); de = dc.exp( dc.to_t( x ) ); }
+            cassert( ss == ds && se == de, "StaticCordic ignores the Precision scope for x=" + std::to_string( x ) );
+        }
+    };
+    { StaticCordic<8,  23, true, uint32_t(-1), uint32_t(-1), T, FLT> sc; Cordic<T,FLT> dc( 8,  23 ); static_check( sc, dc, true  ); }
+    { StaticCordic<11, 40, true, uint32_t(-1), uint32_t(-1), T, FLT> sc; Cordic<T,FLT> dc( 11, 40 ); static_check( sc, dc, false ); }
+    { StaticCordic<5,  10, true, uint32_t(-1), uint32_t(-1), T, FLT> sc; Cordic<T,FLT> dc( 5,  10 ); static_check( sc, dc, true  ); }
+    { StaticCordic<8,   7, true, uint32_t(-1), uint32_t(-1), T, FLT> sc; Cordic<T,FLT> dc( 8,   7 ); static_check( sc, dc, true  ); }
+
+    //---------------------------------------------------------------------------
+    // Batch CORDIC functions must give bit-identical results to the scalar ones.
+    // 11 triples so that both full SIMD blocks and the tail get exercised.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nBATCH:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        const T ONE = T(1) << (dc->frac_w() + dc->guard_w());
+        const size_t CNT = 11;
+        T x0[CNT], y0[CNT], z0[CNT], xb[CNT], yb[CNT], zb[CNT];
+        for( size_t k = 0; k < CNT; k++ )
+        {
+            x0[k] = ONE - T(k) * (ONE / 32);                    // 1 .. 0.6875
+            y0[k] = (T(k) - 5) * (ONE / 16);                    // -0.3125 .. 0.3125
+            z0[k] = (T(k) - 5) * (ONE / 8);
+        }
+        #define do_batch( fn ) \
+            { \
+                dc->fn( CNT, x0, y0, z0, xb, yb, zb ); \
+                for( size_t k = 0; k < CNT; k++ ) \
+                { \
+                    T xs, ys, zs; \
+                    dc->fn( x0[k], y0[k], z0[k], xs, ys, zs ); \
+                    cassert( xb[k] == xs && yb[k] == ys && zb[k] == zs, std::string( #fn ) + " batch differs from scalar" ); \
+                } \
+            }
+        do_batch( circular_rotation )
+        do_batch( circular_vectoring )
+        do_batch( hyperbolic_rotation )
+        do_batch( hyperbolic_vectoring )
+        do_batch( linear_rotation )
+        do_batch( linear_vectoring )
+        #undef do_batch
+        #define do_batch_xy( fn ) \
+            { \
+                dc->fn( CNT, x0, y0, xb, yb ); \
+                for( size_t k = 0; k < CNT; k++ ) \
+                { \
+                    T xs, ys; \
+                    dc->fn( x0[k], y0[k], xs, ys ); \
+                    cassert( xb[k] == xs && yb[k] == ys, std::string( #fn ) + " batch differs from scalar" ); \
+                } \
+            }
+        do_batch_xy( circular_vectoring_xy )
+        do_batch_xy( hyperbolic_vectoring_xy )
+        #undef do_batch_xy
+    }
+
+    //---------------------------------------------------------------------------
+    // Array versions must give bit-identical results to the scalar ones.
+    // Use more than one block, and include some special values.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nARRAY:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        const size_t CNT = 150;
+        std::vector<T> xa( CNT ), ya( CNT ), ra( CNT ), sa( CNT );
+        for( size_t k = 0; k < CNT; k++ )
+        {
+            FLT xf = (k == 0) ? 0.0 : (FLT(k) - 75.0) * 0.0291 + 0.01;       // within -2.2 .. 2.2
+            FLT yf = (k == 1) ? 0.0 : (FLT(k) - 60.0) * 0.0417 - 0.02;
+            xa[k] = dc->to_t( xf );
+            ya[k] = dc->to_t( yf );
+        }
+        #define do_array1( fn ) \
+            dc->fn( xa.data(), ra.data(), CNT ); \
+            for( size_t k = 0; k < CNT; k++ ) \
+            { \
+                cassert( ra[k] == dc->fn( xa[k] ), std::string( #fn ) + " array differs from scalar" ); \
+            }
+        #define do_array2( fn ) \
+            dc->fn( xa.data(), ya.data(), ra.data(), CNT ); \
+            for( size_t k = 0; k < CNT; k++ ) \
+            { \
+                cassert( ra[k] == dc->fn( xa[k], ya[k] ), std::string( #fn ) + " array differs from scalar" ); \
+            }
+        do_array1( sin )
+        do_array1( cos )
+        do_array1( sinpi )
+        do_array1( cospi )
+        do_array1( exp )
+        do_array1( exp2 )
+        do_array1( atan )
+        do_array2( hypot )
+        do_array2( atan2 )
+        do_array2( mul )
+        #undef do_array1
+        #undef do_array2
+
+        dc->sincos( xa.data(), sa.data(), ra.data(), CNT );
+        for( size_t k = 0; k < CNT; k++ )
+        {
+            T si, co;
+            dc->sincos( xa[k], si, co );
+            cassert( sa[k] == si && ra[k] == co, "sincos array differs from scalar" );
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // Parallel array versions must give the same results as the array versions.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nPARALLEL:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        ThreadPool pool( 4 );
+        const size_t CNT = 10000;
+        std::vector<T> xa( CNT ), ra( CNT ), pa( CNT );
+        for( size_t k = 0; k < CNT; k++ )
+        {
+            xa[k] = dc->to_t( (FLT(k) / FLT(CNT) - 0.5) * 4.0 );
+        }
+        dc->sin( xa.data(), ra.data(), CNT );
+        dc->parallel( pool, 256 ).sin( xa.data(), pa.data(), CNT );
+        for( size_t k = 0; k < CNT; k++ ) cassert( pa[k] == ra[k], "parallel sin differs from array sin" );
+        dc->exp( xa.data(), ra.data(), CNT );
+        dc->parallel( pool, 256 ).exp( xa.data(), pa.data(), CNT );
+        for( size_t k = 0; k < CNT; k++ ) cassert( pa[k] == ra[k], "parallel exp differs from array exp" );
+        Cordic<T,FLT> uc( exp_or_int_w, frac_w, is_float );
+        uc.fesetround( FE_UPWARD );
+        uc.exp( xa.data(), ra.data(), CNT );
+        uc.parallel( pool, 256 ).exp( xa.data(), pa.data(), CNT );
+        for( size_t k = 0; k < CNT; k++ ) cassert( pa[k] == ra[k], "parallel exp differs from array exp with FE_UPWARD" );
+        cassert( dc->fegetround() == FE_TONEAREST, "parallel FE_UPWARD leaked into another Cordic" );
+    }
+
+    //---------------------------------------------------------------------------
+    // Radix-4 rotation must be as accurate as radix-2.
+    //---------------------------------------------------------------------------
+    if ( frac_w >= 8 ) {
+        std::cout << "\nRADIX-4:\n";
+        Cordic<T,FLT> r4( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 4 );
+        cassert( r4.radix() == 4, "radix() should be 4" );
+        do_ulps( r4, r4.sin( x ),  std::sin( x ),  -4.0, 4.0, ULPS_SIN,  1.0 );
+        do_ulps( r4, r4.cos( x ),  std::cos( x ),  -4.0, 4.0, ULPS_SIN,  1.0 );
+        do_ulps( r4, r4.exp( x ),  std::exp( x ),  -4.0, 4.0, ULPS_EXP,  0.0 );
+        do_ulps( r4, r4.sinh( x ), std::sinh( x ), -4.0, 4.0, ULPS_EXP,  0.0 );
+        do_ulps( r4, r4.cosh( x ), std::cosh( x ), -4.0, 4.0, ULPS_EXP,  0.0 );
+    }
+
+    //---------------------------------------------------------------------------
+    // Finishing early with one multiply/divide must stay within the same tolerance.
+    //---------------------------------------------------------------------------
+    if ( frac_w >= 8 ) {
+        std::cout << "\nSHORTCUT:\n";
+        Cordic<T,FLT> sc( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, uint32_t(-1) );
+        cassert( sc.shortcut_i() == (frac_w + sc.guard_w() + 1)/2 + 1, "shortcut_i() should be the default" );
+        const T           ty = sc.to_t( 0.7 );
+        const long double yf = sc.to_flt( ty );
+        do_ulps( sc, sc.sin( x ),        std::sin( x ),        -4.0, 4.0, ULPS_SIN,  1.0 );
+        do_ulps( sc, sc.cos( x ),        std::cos( x ),        -4.0, 4.0, ULPS_SIN,  1.0 );
+        do_ulps( sc, sc.exp( x ),        std::exp( x ),        -4.0, 4.0, ULPS_EXP,  0.0 );
+        do_ulps( sc, sc.sinh( x ),       std::sinh( x ),       -4.0, 4.0, ULPS_EXP,  0.0 );
+        do_ulps( sc, sc.atan2( x, ty ),  std::atan2( x, yf ),  -4.0, 4.0, ULPS_SIN,  1.0 );
+        do_ulps( sc, sc.hypot( x, ty ),  std::hypot( x, yf ),  -4.0, 4.0, ULPS_SQRT, 0.0 );
+        do_ulps( sc, sc.log( x ),        std::log( x ),        TINY, 8.0, ULPS_LOG,  1.0 );
+        do_ulps( sc, sc.sqrt( x ),       std::sqrt( x ),       0.0,  8.0, ULPS_SQRT, 0.0 );
+    }
+
+    //---------------------------------------------------------------------------
+    // Starting sin/cos from the (cos,sin) table must stay within the same tolerance,
+    // and the array version must match the scalar one.
+    //---------------------------------------------------------------------------
+    if ( frac_w >= 12 ) {
+        std::cout << "\nSINCOS TABLE:\n";
+        Cordic<T,FLT> lc( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, 6 );
+        cassert( lc.sincos_lut_w() == 6, "sincos_lut_w() should be 6" );
+        do_ulps( lc, lc.sin( x ), std::sin( x ), -4.0, 4.0, ULPS_SIN, 1.0 );
+        do_ulps( lc, lc.cos( x ), std::cos( x ), -4.0, 4.0, ULPS_SIN, 1.0 );
+        const size_t CNT = 5;
+        const FLT xs[CNT] = { 0.681807431807431031, -0.3, 1.5, -2.1, 0.001 };
+        T xa[CNT], ra[CNT];
+        for( size_t k = 0; k < CNT; k++ ) xa[k] = lc.to_t( xs[k] );
+        lc.sin( xa, ra, CNT );
+        for( size_t k = 0; k < CNT; k++ ) cassert( ra[k] == lc.sin( xa[k] ), "table array sin differs from scalar sin" );
+    }
+
+    //---------------------------------------------------------------------------
+    // Starting exp/log from their tables must stay within the same tolerance,
+    // and the array versions must match the scalar ones.
+    //---------------------------------------------------------------------------
+    if ( frac_w >= 12 ) {
+        std::cout << "\nEXP/LOG TABLES:\n";
+        Cordic<T,FLT> ec( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, 0, 6 );
+        cassert( ec.exp_log_lut_w() == 6, "exp_log_lut_w() should be 6" );
+        do_ulps( ec, ec.exp( x ),  std::exp( x ),  -4.0, 4.0, ULPS_EXP, 0.0 );
+        do_ulps( ec, ec.exp2( x ), std::exp2( x ), -4.0, 4.0, ULPS_EXP, 0.0 );
+        do_ulps( ec, ec.log( x ),  std::log( x ),  TINY, 8.0, ULPS_LOG, 1.0 );
+        const size_t CNT = 6;
+        const FLT xs[CNT] = { 0.681807431807431031, -0.3, 1.5, -2.1, 0.001, 2.0 };
+        T xa[CNT], ra[CNT];
+        for( size_t k = 0; k < CNT; k++ ) xa[k] = ec.to_t( xs[k] );
+        ec.exp( xa, ra, CNT );
+        for( size_t k = 0; k < CNT; k++ ) cassert( ra[k] == ec.exp( xa[k] ), "table array exp differs from scalar exp" );
+    }
+
+    //---------------------------------------------------------------------------
+    // The POLY and TABLE function backends must stay within the same tolerance,
+    // and the array versions must match the scalar ones.
+    //---------------------------------------------------------------------------
+    if ( frac_w >= 12 ) {
+        std::cout << "\nFUNCTION BACKENDS:\n";
+        using OP         = Cordic<T,FLT>::OP;
+        using FN_BACKEND = Cordic<T,FLT>::FN_BACKEND;
+        for( FN_BACKEND backend : { FN_BACKEND::POLY, FN_BACKEND::TABLE } )
+        {
+            std::cout << "  backend " << int(backend) << ":\n";
+            Cordic<T,FLT> bc( exp_or_int_w, frac_w, is_float );
+            for( OP op : { OP::sin, OP::exp, OP::log, OP::atan2 } )
+            {
+                if ( !bc.fn_backend_set( op, backend ) ) {
+                    cassert( backend == FN_BACKEND::POLY && bc.fn_backend_get( op ) == FN_BACKEND::CORDIC, "a refused fn_backend_set() should change nothing" );
+                    cassert( bc.fn_backend_set( op, FN_BACKEND::TABLE ), "fn_backend_set() should always take TABLE" );
+                }
+                const FN_BACKEND got = bc.fn_backend_get( op );
+                cassert( got == backend || (backend == FN_BACKEND::POLY && got == FN_BACKEND::TABLE), "fn_backend_set() did not take" );
+                std::cout << "    " << Cordic<T,FLT>::op_to_str( uint16_t(op) ) << " kernel backend " << int(got) << "\n";
+            }
+            cassert( bc.fn_backend_get( OP::cospi ) == bc.fn_backend_get( OP::sin ) && bc.fn_backend_get( OP::exp10 ) == bc.fn_backend_get( OP::exp ) &&
+                     bc.fn_backend_get( OP::log10 ) == bc.fn_backend_get( OP::log ) && bc.fn_backend_get( OP::atan )  == bc.fn_backend_get( OP::atan2 ) &&
+                     bc.fn_backend_get( OP::sqrt )  == FN_BACKEND::CORDIC, "fn_backend_get() does not follow the kernel" );
+            const T           ty = bc.to_t( 0.7 );
+            const long double yf = bc.to_flt( ty );
+            do_ulps( bc, bc.sin( x ),       std::sin( x ),       -4.0, 4.0, ULPS_SIN, 1.0 );
+            do_ulps( bc, bc.cos( x ),       std::cos( x ),       -4.0, 4.0, ULPS_SIN, 1.0 );
+            do_ulps( bc, bc.tan( x ),       std::tan( x ),       -1.4, 1.4, ULPS_TAN, 1.0 );
+            do_ulps( bc, bc.exp( x ),       std::exp( x ),       -4.0, 4.0, ULPS_EXP, 0.0 );
+            do_ulps( bc, bc.exp2( x ),      std::exp2( x ),      -4.0, 4.0, ULPS_EXP, 0.0 );
+            do_ulps( bc, bc.atan( x ),      std::atan( x ),      -4.0, 4.0, ULPS_SIN, 1.0 );
+            do_ulps( bc, bc.atan2( x, ty ), std::atan2( x, yf ), -4.0, 4.0, ULPS_SIN, 1.0 );
+            do_ulps( bc, bc.log( x ),       std::log( x ),       TINY, 8.0, ULPS_LOG, 1.0 );
+            do_ulps( bc, bc.log10( x ),     std::log10( x ),     TINY, 8.0, ULPS_LOG, 1.0 );
+            do_ulps( bc, bc.pow( x, ty ),   std::pow( x, yf ),   TINY, 8.0, ULPS_POW, 0.0 );
+
+            // the array versions must match the scalar ones over random inputs
+            const size_t CNT = 200;
+            std::mt19937_64 rng( 1 );
+            std::uniform_real_distribution<FLT> uniform( -4.0, 4.0 );
+            std::vector<T> xa( CNT ), ra( CNT ), sa( CNT ), ca( CNT );
+            for( size_t k = 0; k < CNT; k++ ) xa[k] = bc.to_t( uniform( rng ) );
+            bc.sincos( xa.data(), sa.data(), ca.data(), CNT );
+            bc.exp( xa.data(), ra.data(), CNT );
+            for( size_t k = 0; k < CNT; k++ )
+            {
+                T sk, ck;
+                bc.sincos( xa[k], sk, ck );
+                cassert( sa[k] == sk && ca[k] == ck, "backend array sincos differs from scalar sincos" );
+                cassert( ra[k] == bc.exp( xa[k] ),   "backend array exp differs from scalar exp" );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // The native arithmetic backend must stay within the same tolerance.
+    // Subnormals must encode and decode the same way in either backend.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nNATIVE:\n";
+        using BACKEND = Cordic<T,FLT>::BACKEND;
+        Cordic<T,FLT> nc( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, 0, 0, BACKEND::NATIVE );
+        cassert( nc.arith_backend() == BACKEND::NATIVE, "arith_backend() should be NATIVE" );
+        const T           tw = nc.to_t( 0.103301038084310970 );
+        const long double wf = nc.to_flt( tw );
+        for( FLT y : { 0.810431798013170871, -1.25, 3.0 } )
+        {
+            const T           ty = nc.to_t( y );
+            const long double yf = nc.to_flt( ty );
+            do_ulps( nc, nc.mul( x, ty ),     x*yf,      -4.0, 4.0, ULPS_MUL, 0.0 );
+            do_ulps( nc, nc.div( x, ty ),     x/yf,      -4.0, 4.0, ULPS_MUL, 0.0 );
+            do_ulps( nc, nc.fma( x, ty, tw ), x*yf + wf, -4.0, 4.0, ULPS_MUL, 1.0 );
+            do_ulps( nc, nc.fda( x, ty, tw ), x/yf + wf, -4.0, 4.0, ULPS_MUL, 1.0 );
+        }
+
+        // a zero product or quotient leaves just the addend, in either backend
+        for( const Cordic<T,FLT> * c : { &nc, freal::implicit_to_get() } )
+        {
+            const T ta = c->to_t( -0.103301038084310970 );
+            const T tb = c->to_t( 1.25 );
+            cassert( c->fma( c->zero(), tb, ta ) == ta && c->fma( tb, c->zero(), ta ) == ta, "fma(0, y, w) should be w" );
+            cassert( c->fda( c->zero(), tb, ta ) == ta, "fda(0, x, w) should be w" );
+        }
+
+        // subnormals must survive to_t() and to_flt(), and keep their value through the arithmetic
+        if ( is_float ) {
+            const FLT min_normal = std::ldexp( 1.0, 3 - (1 << (exp_or_int_w-1)) );
+            for( const Cordic<T,FLT> * c : { &nc, freal::implicit_to_get() } )
+            {
+                for( FLT k : { 1.0, 3.0, std::ldexp( 1.0, frac_w-1 ) + 1.0, std::ldexp( 1.0, frac_w ) - 1.0 } )
+                {
+                    const FLT v = std::ldexp( k, -int(frac_w) ) * min_normal;
+                    cassert( c->to_flt( c->to_t( v ) ) == v && c->to_flt( c->to_t( -v ) ) == -v, "subnormal " + std::to_string( v ) + " should round-trip" );
+                    cassert( c != &nc || c->mul( c->to_t( v ), c->one() ) == c->to_t( v ), "subnormal times 1 should be itself" );   // CORDIC: ULPS_MUL below
+                }
+                cassert( c->to_flt( c->to_t( min_normal ) ) == min_normal, "smallest normal should round-trip" );
+                const FLT ulps_mul = (c == &nc) ? ULPS_MUL : 2.0*ULPS_MUL;      // a CORDIC mul() by 1 is off by up to 2 ulp for normals too
+                do_ulps( *c, c->mul( x, c->one() ), x,            -min_normal, min_normal, ulps_mul,  0.0 );
+                do_ulps( *c, c->add( x, x ),        2.0L*x,       -min_normal, min_normal, ULPS_MUL,  0.0 );
+                do_ulps( *c, c->sqrt( x ),          std::sqrt( x ), 0.0,       min_normal, ULPS_SQRT, 0.0 );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // atan2() and rect_to_polar() in every octant, including the axes.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nATAN2 OCTANTS:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        auto radius = [&]( const T& xx, const T& yy ) { T r, a; dc->rect_to_polar( xx, yy, r, a ); return r; };
+        for( FLT y : { 0.310431798013170871, -0.310431798013170871, 1.5, -1.5 } )
+        {
+            const T           ty = dc->to_t( y );
+            const long double yf = dc->to_flt( ty );
+            do_ulps( *dc, dc->atan2( ty, x ), std::atan2( yf, x ), -4.0, 4.0, ULPS_SIN,  1.0 );
+            do_ulps( *dc, radius( x, ty ),    std::hypot( x, yf ), -4.0, 4.0, ULPS_SQRT, 0.0 );
+        }
+        for( FLT x : { 0.681807431807431031, -0.681807431807431031, 0.2, -0.2, 0.0 } )
+        {
+            for( FLT y : { 0.310431798013170871, -0.310431798013170871, 1.5, -1.5, 0.0 } )
+            {
+                if ( x == 0.0 && y == 0.0 ) continue;
+                T tr, ta;
+                dc->rect_to_polar( dc->to_t( x ), dc->to_t( y ), tr, ta );
+                cassert( ta == dc->atan2( dc->to_t( y ), dc->to_t( x ) ),
+                         "rect_to_polar angle differs from atan2 for x=" + std::to_string( x ) + " y=" + std::to_string( y ) );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // atanh2() with different exponents and near |y/x| == 1, log1p() of small x, and log() of 1.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nATANH2 AND LOG1P:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        for( FLT d : { 2.5, 2.0, -1.0, 0.96 } )
+        {
+            const T           td = dc->to_t( d );
+            const long double df = dc->to_flt( td );
+            const FLT         hi = std::fabs( d ) * 0.99;
+            do_ulps( *dc, dc->atanh2( x, td ), std::atanh( x/df ), -hi, hi, ULPS_ATANH, 1.0 );
+        }
+        cassert( dc->to_flt( dc->atanh( dc->one() ) ) == std::numeric_limits<FLT>::infinity(), "atanh(1) should be +inf" );
+        do_ulps( *dc, dc->log1p( x ), std::log1p( x ), -0.5, 1.0, ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->log1p( x ), std::log1p( x ), -1e-3, 1e-3, ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->log1p( x ), std::log1p( x ), -1e-5, 1e-5, ULPS_LOG, 0.0 );
+        for( FLT z : { 0.0, -0.0 } )
+        {
+            const T tz = dc->to_t( z );
+            cassert( dc->log1p( tz ) == tz, "log1p(+-0) should return x" );
+        }
+        const T tone = dc->one();
+        cassert( dc->log( tone ) == dc->zero() && dc->log2( tone ) == dc->zero() && dc->log10( tone ) == dc->zero(), "log(1) should be 0" );
+        cassert( dc->log( tone, dc->to_t( 3.0 ) ) == dc->zero() && dc->logc( tone, 10.0 ) == dc->zero(), "log(1, b) should be 0" );
+    }
+
+    //---------------------------------------------------------------------------
+    // The r multiplier is folded into the rotation for polar_to_rect(), sin() and sinh(), with and without the sincos table.
+    // Below 12 fraction bits there are only ceil(log2(frac_w)) guard bits, and sinh() just below a power of 2
+    // (e.g., sinh(-2.08) = -3.95) doubles the kernel's error in ulps of the result.  sinh(x) alone is as far off
+    // there (5.3 ulp at -exp_w 8 -frac_w 7), so the r multiplier gets the same allowance rather than a looser one.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nRADIUS:\n";
+        const FLT ulps_sinh = (frac_w < 12) ? 2.0*ULPS_EXP : ULPS_EXP;
+        for( uint32_t lut_w : { 0, 6 } )
+        {
+            if ( lut_w != 0 && frac_w < 12 ) continue;
+            Cordic<T,FLT> pc( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, lut_w );
+            auto rect_x = [&]( const T& r, const T& a ) { T xx, yy; pc.polar_to_rect( r, a, xx, yy ); return xx; };
+            auto rect_y = [&]( const T& r, const T& a ) { T xx, yy; pc.polar_to_rect( r, a, xx, yy ); return yy; };
+            for( FLT r : { 1.0, 0.0, 2.75, -0.3, 0.0078125 } )
+            {
+                const T           tr = pc.to_t( r );
+                const long double rf = pc.to_flt( tr );
+                const FLT         rm = std::fabs( r );
+                do_ulps( pc, rect_x( tr, x ),    rf*std::cos( x ),  -4.0, 4.0, ULPS_SIN, rm );
+                do_ulps( pc, rect_y( tr, x ),    rf*std::sin( x ),  -4.0, 4.0, ULPS_SIN, rm );
+                do_ulps( pc, pc.sinh( x, &tr ),  rf*std::sinh( x ), -4.0, 4.0, ulps_sinh, 0.0 );
+                do_ulps( pc, pc.cosh( x, &tr ),  rf*std::cosh( x ), -4.0, 4.0, ULPS_EXP, 0.0 );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // tan() in each octant and tanh() on both sides of 1, with both backends and the sincos table.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nTAN AND TANH:\n";
+        using BACKEND = typename Cordic<T,FLT>::BACKEND;
+        for( BACKEND backend : { BACKEND::CORDIC, BACKEND::NATIVE } )
+        {
+            Cordic<T,FLT> tc( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, (frac_w >= 12) ? 6 : 0, 0, backend );
+            do_ulps( tc, tc.tan( x ),  std::tan( x ),  -1.4, 1.4, ULPS_TAN, 1.0 );
+            do_ulps( tc, tc.tan( x ),  std::tan( x ),   1.8, 4.5, ULPS_TAN, 1.0 );
+            do_ulps( tc, tc.tanh( x ), std::tanh( x ), -8.0, 8.0, ULPS_EXP, 0.0 );
+            for( FLT hi : { 1e-3, 1e-5 } )
+            {
+                do_ulps( tc, tc.tanh( x ), std::tanh( x ), -hi, hi, ULPS_EXP, 0.0 );
+                do_ulps( tc, tc.sinh( x ), std::sinh( x ), -hi, hi, ULPS_EXP, 0.0 );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // asinh() on both sides of 1 and for negative x, and acosh() near 1 and on both sides of 1.5.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nASINH AND ACOSH:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        do_ulps( *dc, dc->asinh( x ), std::asinh( x ), -16.0, 16.0, ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->asinh( x ), std::asinh( x ), -1e-3, 1e-3, ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->asinh( x ), std::asinh( x ), -1e-5, 1e-5, ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->asinh( x ), std::asinh( x ),  1e3,  1e9,  ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->acosh( x ), std::acosh( x ),   1.0, 16.0, ULPS_LOG, 1.0 );
+        do_ulps( *dc, dc->acosh( x ), std::acosh( x ),   1e3, 1e9,  ULPS_LOG, 0.0 );
+        cassert( std::isnan( dc->to_flt( dc->acosh( dc->to_t( 0.5 ) ) ) ), "acosh(0.5) should be NaN" );
+    }
+
+    //---------------------------------------------------------------------------
+    // rsqrt(), cbrt() and rcbrt() for each exponent mod 3 and negative cube roots, both backends.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nROOTS:\n";
+        using BACKEND = typename Cordic<T,FLT>::BACKEND;
+        for( BACKEND backend : { BACKEND::CORDIC, BACKEND::NATIVE } )
+        {
+            Cordic<T,FLT> rc( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, 0, 0, backend );
+            do_ulps( rc, rc.rsqrt( x ), 1.0L/std::sqrt( x ), TINY,  16.0, ULPS_SQRT, 0.0 );
+            do_ulps( rc, rc.cbrt( x ),  std::cbrt( x ),      -16.0, 16.0, ULPS_SQRT, 0.0 );
+            do_ulps( rc, rc.rcbrt( x ), 1.0L/std::cbrt( x ), -16.0, 16.0, ULPS_SQRT, 0.0 );
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // asin() and acos() on both sides of 1/2 and near +/-1, where acos() is small and
+    // must keep relative precision, both backends.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nASIN AND ACOS:\n";
+        using BACKEND = typename Cordic<T,FLT>::BACKEND;
+        for( BACKEND backend : { BACKEND::CORDIC, BACKEND::NATIVE } )
+        {
+            Cordic<T,FLT> ac( exp_or_int_w, frac_w, is_float, uint32_t(-1), uint32_t(-1), 2, 0, 0, 0, backend );
+            do_ulps( ac, ac.asin( x ), std::asin( x ), -1.0, 1.0, ULPS_ASIN, 0.0 );
+            do_ulps( ac, ac.acos( x ), std::acos( x ), -1.0, 1.0, ULPS_ASIN, 0.0 );
+            cassert( std::isnan( ac.to_flt( ac.asin( ac.to_t( 1.5 ) ) ) ), "asin(1.5) should be NaN" );
+            cassert( std::isnan( ac.to_flt( ac.acos( ac.to_t( -1.5 ) ) ) ), "acos(-1.5) should be NaN" );
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // sin() and cos() of huge arguments (integer range reduction) and sinpi()/cospi().
+    //---------------------------------------------------------------------------
+    if ( is_float ) {
+        std::cout << "\nLARGE SIN AND COS ARGUMENTS:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        const FLT big = std::ldexp( 1.0, std::min( (1 << (exp_or_int_w-1)) - 2, 1000 ) );
+        for( FLT hi : { 1e7, big } )
+        {
+            do_ulps( *dc, dc->sin( x ), std::sin( x ), -hi, hi, ULPS_SIN, 1.0 );
+            do_ulps( *dc, dc->cos( x ), std::cos( x ), -hi, hi, ULPS_SIN, 1.0 );
+        }
+        do_ulps( *dc, dc->sinpi( x ), std::sin( M_PIl * std::fmod( x, 2.0L ) ), -1e4, 1e4, ULPS_SIN, 1.0 );
+        do_ulps( *dc, dc->cospi( x ), std::cos( M_PIl * std::fmod( x, 2.0L ) ), -1e4, 1e4, ULPS_SIN, 1.0 );
+    }
+
+    //---------------------------------------------------------------------------
+    // pown(), rootn(), and pow() with an integer exponent, including negative bases.
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nPOWN AND ROOTN:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        for( int n : { 0, 1, 2, 3, -1, -2, 5, -7 } )
+        {
+            const long double nf = n;
+            do_ulps( *dc, dc->pown( x, n ), std::pow( x, nf ), -4.0, 4.0, ULPS_POW, 0.0 );
+            if ( n != 0 ) {
+                const FLT lo = (n & 1) ? -16.0 : 0.0;
+                do_ulps( *dc, dc->rootn( x, n ), std::copysign( std::pow( std::fabs( x ), 1.0L/nf ), x ), lo, 16.0, ULPS_POW, 0.0 );
+            }
+        }
+        for( int n : { 1000003, -999999, 2147483647, -2147483647 } )
+        {
+            // the error grows with |n| unless pown_fxd() widens its fraction
+            const long double nf = n;
+            const FLT         hi = std::exp( 60.0 / std::fabs( FLT(n) ) );
+            do_ulps( *dc, dc->pown( x, n ),  std::pow( x, nf ),       1.0/hi, hi,     ULPS_POW, 0.0 );
+            do_ulps( *dc, dc->rootn( x, n ), std::pow( x, 1.0L/nf ), TINY,   1e30,   ULPS_POW, 0.0 );
+        }
+        for( FLT x : { 0.75, 1.0, 1.3, -1.7, 2.0, -3.25 } )
+        {
+            for( int n : { 0, 1, 2, 3, -1, -2, 5, -7 } )
+            {
+                cassert( dc->pown( dc->to_t( x ), n ) == dc->pow( dc->to_t( x ), dc->to_t( FLT(n) ) ),
+                         "pow(" + std::to_string( x ) + ", " + std::to_string( n ) + ") differs from pown()" );
+            }
+        }
+        cassert( std::isnan( dc->to_flt( dc->rootn( dc->to_t( -2.0 ), 4 ) ) ), "rootn(-2, 4) should be NaN" );
+        cassert( std::isnan( dc->to_flt( dc->rootn( dc->to_t( 2.0 ), 0 ) ) ), "rootn(2, 0) should be NaN" );
+    }
+
+    //---------------------------------------------------------------------------
+    // exp2() and log2() take their integer part straight from the exponent, and
+    // log(x, b) keeps the constants for other bases between calls.
+    //---------------------------------------------------------------------------
+    if ( is_float ) {
+        std::cout << "\nEXP2 AND LOG2:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        for( int n : { -3, -1, 0, 1, 2, 5 } )
+        {
+            cassert( dc->to_flt( dc->exp2( dc->to_t( FLT(n) ) ) ) == std::ldexp( 1.0, n ), "exp2(" + std::to_string( n ) + ") should be exact" );
+            cassert( dc->to_flt( dc->log2( dc->to_t( std::ldexp( 1.0, n ) ) ) ) == FLT(n), "log2(2^" + std::to_string( n ) + ") should be exact" );
+        }
+        do_ulps( *dc, dc->exp2( x ), std::exp2( x ), -8.0, 8.0, ULPS_EXP, 0.0 );
+        do_ulps( *dc, dc->log2( x ), std::log2( x ), TINY, 16.0, ULPS_LOG, 1.0 );
+        do_ulps( *dc, dc->log2( x ), std::log2( x ), 0.5, 1.5, ULPS_LOG, 0.0 );
+        do_ulps( *dc, dc->log2( x ), std::log2( x ), 1.0-1e-3, 1.0+1e-3, ULPS_LOG, 0.0 );
+        for( FLT b : { 3.0, 10.0, 3.0, 0.5 } )
+        {
+            const T           tb = dc->to_t( b );
+            const long double bf = dc->to_flt( tb );
+            do_ulps( *dc, dc->log( x, tb ), std::log( x ) / std::log( bf ), TINY, 16.0, ULPS_LOG, 1.0 );
+        }
+
+        // more other bases than the per-Cordic table holds, each used twice
+        for( int pass = 0; pass < 2; pass++ )
+        {
+            for( FLT b : { 3.0, 0.5, 7.0, 11.0, 13.0, 1.5 } )
+            {
+                const long double bf = b;
+                do_ulps( *dc, dc->logc( x, b ), std::log( x ) / std::log( bf ), TINY, 16.0, ULPS_LOG, 1.0 );
+                do_ulps( *dc, dc->expc( b, x ), std::pow( bf, x ),              -4.0, 4.0,  ULPS_EXP, 0.0 );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // A Precision scope trades bits for fewer iterations and ends with the scope.
+    //---------------------------------------------------------------------------
+    if ( is_float && frac_w > 12 ) {
+        std::cout << "\nPRECISION SCOPE:\n";
+        const Cordic<T,FLT> * dc = freal::implicit_to_get();
+        const FLT PULPS = std::ldexp( 1.0, frac_w - 11 );                   // 2^-11
+        {
+            auto p = dc->precision( 12 );
+            do_ulps( *dc, dc->sin( x ),  std::sin( x ),  -4.0, 4.0, PULPS, 1.0 );
+            do_ulps( *dc, dc->cos( x ),  std::cos( x ),  -4.0, 4.0, PULPS, 1.0 );
+            do_ulps( *dc, dc->atan( x ), std::atan( x ), -4.0, 4.0, PULPS, 1.0 );
+            do_ulps( *dc, dc->exp( x ),  std::exp( x ),  -4.0, 4.0, PULPS, 0.0 );
+        }
+        for( FLT x : { 0.1, 0.75, 1.3, -0.6 } )
+        {
+            const T tx       = dc->to_t( x );
+            const T full_sin = dc->sin( tx );
+            const T full_exp = dc->exp( tx );
+            { auto p = dc->precision( 12 ); }
+            cassert( dc->sin( tx ) == full_sin && dc->exp( tx ) == full_exp, "precision scope did not end" );
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // Correctly-rounded mode must match the long double result rounded to frac_w
+    // in the same mode, whether the fast path decides or a retry does.
+    // Exact results must come out exact in every mode.
+    // The array and parallel versions must give the same results as the scalar ones.
+    //---------------------------------------------------------------------------
+    if ( is_float && (exp_or_int_w + frac_w + 16 + 10) <= 62 ) {
+        std::cout << "\nCORRECTLY ROUNDED:\n";
+        using LDBL = long double;
+        const LDBL PI_L = 3.141592653589793238462643383279502884L;
+        auto sinpi_ref = [&]( LDBL v ) { return (v == std::trunc( v )) ? 0.0L : std::sin( PI_L*std::remainder( v, 2.0L ) ); };  // exact 0 at integers
+        ThreadPool pool( 4 );
+        std::mt19937_64 rng( 1 );
+        std::uniform_real_distribution<FLT> uniform( -4.0, 4.0 );
+        const size_t CNT = 300;
+        std::vector<FLT> xs( CNT );
+        std::vector<FLT> ys( CNT );
+        for( size_t i = 0; i < CNT; i++ )
+        {
+            xs[i] = uniform( rng );
+            ys[i] = uniform( rng );
+        }
+        for( uint32_t guard_w : { uint32_t(-1), uint32_t(16) } )                // default: mostly retries; 16: mostly fast path
+        for( int rmode : { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD } )
+        {
+            Cordic<T,FLT> cc( exp_or_int_w, frac_w, true, guard_w, (guard_w == 16) ? (frac_w + 16) : uint32_t(-1) );
+            cc.correctly_rounded_set( true );
+            cc.fesetround( rmode );
+            auto rounded = [&]( LDBL v )
+            {
+                if ( v == 0.0L ) return FLT( v );
+                int e;
+                std::frexp( v, &e );
+                e = std::max( e, 4 - (1 << (exp_or_int_w-1)) );                    // subnormals keep the smallest normal's lsb
+                const LDBL m = std::ldexp( v, int(frac_w) + 1 - e );               // frac_w+1 significant bits left of the point
+                const LDBL mr = (rmode == FE_TONEAREST) ? std::nearbyint( m ) :
+                                (rmode == FE_UPWARD)    ? std::ceil( m ) :
+                                (rmode == FE_DOWNWARD)  ? std::floor( m ) : std::trunc( m );
+                return FLT( std::ldexp( mr, e - int(frac_w) - 1 ) );
+            };
+            auto check = [&]( const char * name, FLT x, const T& r, LDBL ref )
+            {
+                cassert( cc.to_flt( r ) == rounded( ref ), std::string( name ) + "(" + std::to_string( x ) + ") is not correctly rounded" );
+            };
+
+            std::vector<T> ta( CNT );
+            for( size_t i = 0; i < CNT; i++ )
+            {
+                const T    tx = cc.to_t( xs[i] );
+                const T    ty = cc.to_t( ys[i] );
+                const LDBL x  = cc.to_flt( tx );
+                const LDBL y  = cc.to_flt( ty );
+                const T    tp = cc.to_t( std::fabs( xs[i] ) + 0.125 );             // 0.125 .. 4.125
+                const LDBL p  = cc.to_flt( tp );
+                T r1, r2;
+                check( "sin",    xs[i], cc.sin( tx ),    std::sin( x ) );
+                check( "cos",    xs[i], cc.cos( tx ),    std::cos( x ) );
+                check( "atan",   xs[i], cc.atan( tx ),   std::atan( x ) );
+                check( "exp",    xs[i], cc.exp( tx ),    std::exp( x ) );
+                check( "tanh",   xs[i], cc.tanh( tx ),   std::tanh( x ) );
+                check( "log",    xs[i], cc.log( tp ),    std::log( p ) );
+                check( "sqrt",   xs[i], cc.sqrt( tp ),   std::sqrt( p ) );
+                check( "pown3",  xs[i], cc.pown( tp, 3 ),  std::pow( p, 3 ) );
+                check( "pown-2", xs[i], cc.pown( tp, -2 ), std::pow( p, -2 ) );
+                check( "rootn5", xs[i], cc.rootn( tp, 5 ), std::pow( p, 1.0L/5.0L ) );
+                cc.sincos( tx, r1, r2 );
+                check( "sincos.sin", xs[i], r1, std::sin( x ) );
+                check( "sincos.cos", xs[i], r2, std::cos( x ) );
+                cc.sinpicospi( tx, r1, r2 );
+                check( "sinpicospi.sinpi", xs[i], r1, sinpi_ref( x ) );
+                check( "sinpicospi.cospi", xs[i], r2, sinpi_ref( x + 0.5L ) );
+                cc.sinhcosh( tx, r1, r2 );
+                check( "sinhcosh.sinh", xs[i], r1, std::sinh( x ) );
+                check( "sinhcosh.cosh", xs[i], r2, std::cosh( x ) );
+                cc.polar_to_rect( tp, ty, r1, r2 );
+                check( "polar_to_rect.x", xs[i], r1, p*std::cos( y ) );
+                check( "polar_to_rect.y", xs[i], r2, p*std::sin( y ) );
+                cc.rect_to_polar( tx, ty, r1, r2 );
+                check( "rect_to_polar.r", xs[i], r1, std::sqrt( x*x + y*y ) );
+                check( "rect_to_polar.a", xs[i], r2, std::atan2( y, x ) );
+                ta[i] = tx;
+            }
+
+            for( FLT v : { 1.0, 1.5, 3.0, 0.375, 5.0, 13.0, 0.625 } )
+            {
+                const T tv  = cc.to_t( v );
+                const T tv2 = cc.to_t( v*v );
+                const T tv3 = cc.to_t( v*1.5 );
+                check( "sqrt",  v*v,  cc.sqrt( tv2 ),               v );
+                check( "mul",   v,    cc.mul( tv, cc.to_t( 1.5 ) ), v*1.5 );
+                check( "div",   v,    cc.div( tv3, tv ),            1.5 );
+                check( "div",   v,    cc.div( tv, cc.to_t( 4.0 ) ), v/4.0 );
+                check( "pown2", v,    cc.pown( tv, 2 ),             v*v );
+                check( "rootn2", v*v, cc.rootn( tv2, 2 ),           v );
+            }
+            check( "sqrt",   2.25, cc.sqrt( cc.to_t( 2.25 ) ),                    1.5 );
+            check( "div",    1.0,  cc.div( cc.one(), cc.to_t( 4.0 ) ),             0.25 );
+            check( "hypot",  3.0,  cc.hypot( cc.to_t( 3.0 ), cc.to_t( 4.0 ) ),     5.0 );
+            check( "hypot",  5.0,  cc.hypot( cc.to_t( 5.0 ), cc.to_t( 12.0 ) ),    13.0 );
+            check( "rootn5", 32.0, cc.rootn( cc.to_t( 32.0 ), 5 ),                2.0 );
+            check( "rootn3", 27.0, cc.rootn( cc.to_t( 27.0 ), 3 ),                3.0 );
+            check( "log",    1.0,  cc.log( cc.one() ),                            0.0 );
+            check( "exp",    0.0,  cc.exp( cc.zero() ),                           1.0 );
+
+            std::vector<T> ra( CNT );
+            std::vector<T> rb( CNT );
+            #define do_cr_array( name ) \
+                cc.name( ta.data(), ra.data(), CNT ); \
+                cc.parallel( pool, 64 ).name( ta.data(), rb.data(), CNT ); \
+                for( size_t i = 0; i < CNT; i++ ) cassert( ra[i] == cc.name( ta[i] ) && rb[i] == ra[i], #name " array is not correctly rounded" );
+            do_cr_array( sin )
+            do_cr_array( cos )
+            do_cr_array( exp )
+            do_cr_array( exp2 )
+            do_cr_array( tanh )
+            #undef do_cr_array
+            cc.sincos( ta.data(), ra.data(), rb.data(), CNT );
+            for( size_t i = 0; i < CNT; i++ ) 
+            {
+                T r1, r2;
+                cc.sincos( ta[i], r1, r2 );
+                cassert( ra[i] == r1 && rb[i] == r2, "sincos array is not correctly rounded" );
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // mulc() is a plain mul(); the shift/add plans behind the internal constants are
+    // exercised by the functions that use them (atan, log, exp, ...).
+    //---------------------------------------------------------------------------
+    {
+        std::cout << "\nMULC:\n";
+        Cordic<T,FLT> mc( exp_or_int_w, frac_w, is_float );
+        for( FLT c : { M_PI, 1.0/M_PI, 4.0/M_PI, M_PI/4.0, std::sqrt(2.0)/2.0, std::log(2.0), -1.0/3.0, 1.0/180.0 } )
+        {
+            const T tc = mc.to_t( c );
+            for( FLT xx : { 1.0, -0.151162960949111691, 3.75, -2.06619117789215334e-05 } )
+            {
+                const T tx = mc.to_t( xx );
+                cassert( mc.mulc( tx, tc ) == mc.mul( tx, tc ), "mulc() should be the same as mul()" );
+            }
+        }
+    }
+
     std::cout << "PASSED\n";
     return 0;
 }
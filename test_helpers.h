@@ -24,6 +24,8 @@
 #define _test_helpers_h
 
 #include "freal.h"
+#include <random>
+#include <vector>
 
 // some useful macros to avoid redundant typing
 //
@@ -237,6 +239,76 @@ static inline FLT tolerance( uint32_t frac_w, FLT expected, FLT tol, int32_t& to
     cassert( (std::isnan(fltz) && std::isnan(flte) || flterr <= tol), "outside tolerance" );			\
 }    
 
+//------------------------------------------------------------
+// Checks that fn is within max_ulps of ref over some edge inputs (0, +/-tiny, near 1, lo, hi)
+// and rand_cnt random inputs in lo .. hi, half of them scaled down by a random power of 2
+// so that small arguments get covered.  Each input is rounded to c's format first, and ref
+// is evaluated on that in long double.  For floating-point, an ulp is relative to ref, or to
+// ulp_floor if |ref| is smaller (use 1 for functions whose error is absolute, like sin near 0);
+// for fixed-point, it is the lsb.  Prints and returns the max error in ulps.
+//------------------------------------------------------------
+template< typename FN, typename REF >
+static inline FLT check_ulps( const Cordic<T,FLT>& c, const std::string& name, FN fn, REF ref,
+                              FLT lo, FLT hi, FLT max_ulps, FLT ulp_floor=0.0, uint32_t rand_cnt=1000 )
+{
+    using LDBL = long double;
+    const int32_t frac_w = c.frac_w();
+    std::vector<FLT> xs = { 0.0, 1.0, lo, hi };
+    for( int32_t e : { 2, 10, frac_w/2, frac_w+2 } )
+    {
+        for( FLT sgn : { 1.0, -1.0 } )
+        {
+            xs.push_back( sgn * std::ldexp( 1.0, -e ) );
+            xs.push_back( sgn * (1.0 + std::ldexp( 1.0, -std::min( e, frac_w ) )) );
+            xs.push_back( sgn * (1.0 - std::ldexp( 1.0, -std::min( e, frac_w ) )) );
+        }
+    }
+    const LDBL max = c.to_flt( c.max() );
+    std::mt19937_64 rng( 1 );
+    std::uniform_real_distribution<FLT> uniform( lo, hi );
+    std::uniform_int_distribution<int32_t> scale( 1, frac_w );
+    for( uint32_t i = 0; i < rand_cnt; i++ )
+    {
+        FLT x  = uniform( rng );
+        FLT xs_small = std::ldexp( x, -scale( rng ) );
+        xs.push_back( ((i & 1) && xs_small >= lo && xs_small <= hi) ? xs_small : x );
+    }
+
+    FLT worst   = 0.0;
+    FLT worst_x = 0.0;
+    for( FLT x : xs )
+    {
+        if ( x < lo || x > hi ) continue;
+        const T           tx = c.to_t( x );
+        const LDBL        xf = c.to_flt( tx );
+        LDBL              rf = ref( xf );
+        if ( c.is_float() && std::fabs( rf ) > max ) rf = std::copysign( LDBL( INFINITY ), rf );    // overflows
+        const FLT         r  = c.to_flt( fn( tx ) );
+        FLT err;
+        if ( std::isnan( rf ) || std::isinf( rf ) ) {
+            err = (std::isnan( rf ) ? std::isnan( r ) : (r == rf)) ? 0.0 : INFINITY;
+        } else {
+            const int32_t exp_min = 3 - (1 << (c.exp_w()-1));                      // smallest normal exponent
+            const LDBL    rm      = std::fmax( std::fabs( rf ), LDBL( ulp_floor ) );
+            const int32_t ulp_lg2 = c.is_float() ? (((rm == 0.0L) ? exp_min : std::max( std::ilogb( rm ), exp_min )) - frac_w) : -frac_w;
+            err = std::isnan( r ) ? INFINITY : FLT( std::fabs( LDBL( r ) - rf ) / std::ldexp( 1.0L, ulp_lg2 ) );
+        }
+        if ( !(err <= worst) ) {
+            worst   = err;
+            worst_x = x;
+        }
+    }
+    std::cout << "    " << std::setw(24) << std::left << name << std::right << " max " << std::setw(10) << worst << " ulp at x=" << worst_x << "\n";
+    cassert( worst <= max_ulps, name + " is " + std::to_string( worst ) + " ulp at x=" + std::to_string( worst_x ) + 
+                                ", which is more than " + std::to_string( max_ulps ) );
+    return worst;
+}
+
+// check_ulps() with expr and ref_expr written in terms of x, e.g. do_ulps( c, c.sin( x ), std::sin( x ), -4.0, 4.0, 1.0, 1.0 )
+//
+#define do_ulps( c, expr, ref_expr, lo, hi, max_ulps, ulp_floor ) \
+    check_ulps( c, #expr, [&]( const T& x ) { return expr; }, [&]( long double x ) { return ref_expr; }, lo, hi, max_ulps, ulp_floor )
+
 // FLT wrapper routines for those that are not in std::
 //
 FLT  add( FLT x, FLT y ) { return x+y; }
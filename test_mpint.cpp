@@ -88,6 +88,23 @@ int main( int argc, const char * argv[] )
         std::cout << "should get y0=" << z << "\n";
         iassert( z == y0, "y - y1 != y0" );
     }
+    //---------------------------------------------------------------------------
+    // Leading zero count across word boundaries.
+    //---------------------------------------------------------------------------
+    for( int int_w : { 48, 64, 128, 200 } )
+    {
+        mpint::implicit_int_w_set( int_w );
+        std::cout << "\nclz int_w=" << int_w << "\n";
+        iassert( mpint( 0 ).clz() == int_w,      "clz(0) != int_w" );
+        iassert( mpint( 1 ).clz() == int_w-1,    "clz(1) != int_w-1" );
+        iassert( mpint( -1 ).clz() == 0,         "clz(-1) != 0" );
+        for( int i = 0; i < int_w-1; i++ )
+        {
+            mpint y = mpint( 1 ) << i;
+            iassert( y.clz() == int_w-1-i,       "clz(1 << " + std::to_string( i ) + ") is wrong" );
+            iassert( (y + y - mpint( 1 )).clz() == int_w-1-i, "clz((2 << i) - 1) is wrong" );
+        }
+    }
     std::cout << "\nPASSED\n";
     return 0;
 }
@@ -0,0 +1,237 @@
+// Copyright (c) 2014-2019 Robert A. Alfieri
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// test_noalloc.cpp - check that the math functions never allocate from the heap (with no logger installed)
+//
+#include "Cordic.h"
+#include "ThreadPool.h"
+
+#include <new>
+#include <cstdlib>
+#include <atomic>
+#include <vector>
+
+using T   = int64_t;
+using FLT = double;
+
+static std::atomic<bool>   counting( false );          // parallel() workers allocate on their own threads
+static std::atomic<size_t> alloc_cnt( 0 );
+
+// operator new[] and delete[] go through these
+void * operator new( size_t size )
+{
+    if ( counting ) alloc_cnt++;
+    void * p = std::malloc( (size == 0) ? 1 : size );
+    if ( p == nullptr ) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void * p ) noexcept
+{
+    std::free( p );
+}
+
+void operator delete( void * p, size_t size ) noexcept
+{
+    (void)size;
+    std::free( p );
+}
+
+#define do_noalloc( str, expr )                                                         \
+{                                                                                       \
+    alloc_cnt = 0;                                                                      \
+    counting  = true;                                                                   \
+    expr;                                                                               \
+    counting  = false;                                                                  \
+    cassert( alloc_cnt == 0, std::string( str ) + " allocated " + std::to_string( alloc_cnt ) + \
+                             " times with x=" + std::to_string( x ) );                  \
+}
+
+#define do_noalloc_mode( str, expr )                                                   \
+{                                                                                       \
+    alloc_cnt = 0;                                                                      \
+    counting  = true;                                                                   \
+    expr;                                                                               \
+    counting  = false;                                                                  \
+    cassert( alloc_cnt == 0, std::string( str ) + " allocated " + std::to_string( alloc_cnt ) + \
+                             " times in " + mode_str + " mode" );                       \
+}
+
+int main( int argc, const char * argv[] )
+{
+    (void)argc;
+    (void)argv;
+
+    //---------------------------------------------------------------------------
+    // Same functions as test_basic.cpp, for a few formats and both arithmetic backends.
+    //---------------------------------------------------------------------------
+    using BACKEND = Cordic<T,FLT>::BACKEND;
+    for( BACKEND backend : { BACKEND::CORDIC, BACKEND::NATIVE } )
+    {
+        for( uint32_t frac_w : { 23, 46 } )
+        {
+            uint32_t exp_w = (frac_w > 23) ? 11 : 8;
+            std::cout << "exp_w=" << exp_w << " frac_w=" << frac_w << " backend=" << int(backend) << "\n";
+            Cordic<T,FLT> c( exp_w, frac_w, true, uint32_t(-1), uint32_t(-1), 2, 0, 0, 0, backend );
+            for( FLT x : { 0.681807431807431031, 3.681807431807431031, -0.3, 1.000000204890966415405273437500 } )
+            {
+                const T tx = c.to_t( x );
+                const T ty = c.to_t( 0.810431798013170871 );
+                const T tw = c.to_t( 0.103301038084310970 );
+                const T tb = c.to_t( M_E * 1.1 );
+                const T ta = c.to_t( 0.5 );
+                const T t1 = c.to_t( 1.5 );
+                T r, r2;
+                do_noalloc( "fma",           r = c.fma( tx, ty, tw ) )
+                do_noalloc( "mul",           r = c.mul( tx, ty ) )
+                do_noalloc( "mulc",          r = c.mulc( tx, c.pi() ) )
+                do_noalloc( "fda",           r = c.fda( ty, tx, tw ) )
+                do_noalloc( "div",           r = c.div( ty, tx ) )
+                do_noalloc( "add",           r = c.add( tx, ty ) )
+                do_noalloc( "sub",           r = c.sub( tx, ty ) )
+                do_noalloc( "fdim",          r = c.fdim( tx, ty ) )
+                do_noalloc( "fmax",          r = c.fmax( tx, ty ) )
+                do_noalloc( "fmin",          r = c.fmin( tx, ty ) )
+                do_noalloc( "exp",           r = c.exp( tx ) )
+                do_noalloc( "expm1",         r = c.expm1( tx ) )
+                do_noalloc( "exp2",          r = c.exp2( tx ) )
+                do_noalloc( "exp10",         r = c.exp10( tx ) )
+                do_noalloc( "pow",           r = c.pow( tb, ty ) )
+                do_noalloc( "pown",          r = c.pown( tx, 5 ) )
+                do_noalloc( "rootn",         r = c.rootn( tb, 5 ) )
+                do_noalloc( "sin",           r = c.sin( ta ) )
+                do_noalloc( "cos",           r = c.cos( ta ) )
+                do_noalloc( "sincos",        c.sincos( ta, r, r2 ) )
+                do_noalloc( "tan",           r = c.tan( ta ) )
+                do_noalloc( "atan2",         r = c.atan2( ty, tx ) )
+                do_noalloc( "sinh",          r = c.sinh( tx ) )
+                do_noalloc( "cosh",          r = c.cosh( tx ) )
+                do_noalloc( "sinhcosh",      c.sinhcosh( tx, r, r2 ) )
+                do_noalloc( "tanh",          r = c.tanh( tx ) )
+                do_noalloc( "asinh",         r = c.asinh( tx ) )
+                do_noalloc( "acosh",         r = c.acosh( t1 ) )
+                do_noalloc( "hypot",         r = c.hypot( ty, tx ) )
+                do_noalloc( "rect_to_polar", c.rect_to_polar( tx, ty, r, r2 ) )
+                do_noalloc( "polar_to_rect", c.polar_to_rect( tx, ty, r, r2 ) )
+                if ( x > 0.0 ) {
+                    do_noalloc( "rcp",       r = c.rcp( tx ) )
+                    do_noalloc( "sqrt",      r = c.sqrt( tx ) )
+                    do_noalloc( "rsqrt",     r = c.rsqrt( tx ) )
+                    do_noalloc( "cbrt",      r = c.cbrt( tx ) )
+                    do_noalloc( "rcbrt",     r = c.rcbrt( tx ) )
+                    do_noalloc( "log",       r = c.log( tx ) )
+                    do_noalloc( "log1p",     r = c.log1p( tx ) )
+                    do_noalloc( "log(x,b)",  r = c.log( tx, tb ) )
+                    do_noalloc( "log2",      r = c.log2( tx ) )
+                    do_noalloc( "log10",     r = c.log10( tx ) )
+                }
+                if ( x >= -1.0 && x <= 1.0 ) {
+                    do_noalloc( "asin",      r = c.asin( tx ) )
+                    do_noalloc( "acos",      r = c.acos( tx ) )
+                    do_noalloc( "atan",      r = c.atan( tx ) )
+                    do_noalloc( "atanh",     r = c.atanh( c.to_t( x/2.0 ) ) )
+                    do_noalloc( "atanh2",    r = c.atanh2( c.to_t( x/2.0 ), ty ) )
+                    do_noalloc( "hypoth",    r = c.hypoth( ty, c.to_t( x/2.0 ) ) )
+                }
+                (void)r;
+                (void)r2;
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------
+    // The array versions of every function, also through parallel() on a pool that has been
+    // used once so that its task queues have grown, with the POLY and TABLE function backends
+    // and in correctly-rounded mode (which retries on the shadow Cordic).
+    //---------------------------------------------------------------------------
+    using OP         = Cordic<T,FLT>::OP;
+    using FN_BACKEND = Cordic<T,FLT>::FN_BACKEND;
+    ThreadPool pool( 4 );
+    const size_t CNT = 1000;
+    std::vector<T> xv( CNT ), yv( CNT ), zv( CNT ), r1v( CNT ), r2v( CNT );
+    T * xa  = xv.data();
+    T * ya  = yv.data();
+    T * za  = zv.data();
+    T * r1a = r1v.data();
+    T * r2a = r2v.data();
+    for( uint32_t frac_w : { 23, 46 } )
+    {
+        uint32_t exp_w = (frac_w > 23) ? 11 : 8;
+        for( const char * mode_str : { "CORDIC", "POLY", "TABLE", "correctly-rounded" } )
+        {
+            const std::string mode( mode_str );
+            if ( mode == "correctly-rounded" && frac_w > 23 ) continue;     // the shadow Cordic would not fit in T
+            std::cout << "exp_w=" << exp_w << " frac_w=" << frac_w << " " << mode_str << " arrays\n";
+            Cordic<T,FLT> c( exp_w, frac_w, true );
+            for( OP op : { OP::sin, OP::exp, OP::log, OP::atan2 } )
+            {
+                if ( mode == "POLY" && !c.fn_backend_set( op, FN_BACKEND::POLY ) ) c.fn_backend_set( op, FN_BACKEND::TABLE );
+                if ( mode == "TABLE" ) c.fn_backend_set( op, FN_BACKEND::TABLE );
+            }
+            if ( mode == "correctly-rounded" ) c.correctly_rounded_set( true );
+            for( size_t k = 0; k < CNT; k++ )
+            {
+                xa[k] = c.to_t( 0.001 + 0.998 * FLT(k) / FLT(CNT) );
+                ya[k] = c.to_t( 0.810431798013170871 );
+                za[k] = c.to_t( 0.103301038084310970 );
+            }
+            c.parallel( pool, 64 ).exp( xa, r1a, CNT );
+
+            #define _na_1( name )   do_noalloc_mode( #name,   c.name( xa, r1a, CNT ) ) \
+                                    do_noalloc_mode( "parallel " #name, c.parallel( pool, 64 ).name( xa, r1a, CNT ) )
+            #define _na_2( name )   do_noalloc_mode( #name,   c.name( xa, ya, r1a, CNT ) ) \
+                                    do_noalloc_mode( "parallel " #name, c.parallel( pool, 64 ).name( xa, ya, r1a, CNT ) )
+            #define _na_3( name )   do_noalloc_mode( #name,   c.name( xa, ya, za, r1a, CNT ) ) \
+                                    do_noalloc_mode( "parallel " #name, c.parallel( pool, 64 ).name( xa, ya, za, r1a, CNT ) )
+            #define _na_1_2( name ) do_noalloc_mode( #name,   c.name( xa, r1a, r2a, CNT ) ) \
+                                    do_noalloc_mode( "parallel " #name, c.parallel( pool, 64 ).name( xa, r1a, r2a, CNT ) )
+            #define _na_2_2( name ) do_noalloc_mode( #name,   c.name( xa, ya, r1a, r2a, CNT ) ) \
+                                    do_noalloc_mode( "parallel " #name, c.parallel( pool, 64 ).name( xa, ya, r1a, r2a, CNT ) )
+            _CORDIC_ARRAY_FUNCS( _na_1, _na_2, _na_3, _na_1_2, _na_2_2 )
+            #undef _na_1
+            #undef _na_2
+            #undef _na_3
+            #undef _na_1_2
+            #undef _na_2_2
+
+            // scalar versions for the kernels with other backends and for correctly-rounded mode
+            const T tx = xa[CNT/3];
+            const T ty = ya[0];
+            T r, r2;
+            do_noalloc_mode( "sin",    r = c.sin( tx ) )
+            do_noalloc_mode( "sincos", c.sincos( tx, r, r2 ) )
+            do_noalloc_mode( "tan",    r = c.tan( tx ) )
+            do_noalloc_mode( "exp",    r = c.exp( tx ) )
+            do_noalloc_mode( "exp10",  r = c.exp10( tx ) )
+            do_noalloc_mode( "log",    r = c.log( tx ) )
+            do_noalloc_mode( "log10",  r = c.log10( tx ) )
+            do_noalloc_mode( "atan",   r = c.atan( tx ) )
+            do_noalloc_mode( "atan2",  r = c.atan2( ty, tx ) )
+            do_noalloc_mode( "pow",    r = c.pow( ty, tx ) )
+            do_noalloc_mode( "sqrt",   r = c.sqrt( tx ) )
+            do_noalloc_mode( "tanh",   r = c.tanh( tx ) )
+            (void)r;
+            (void)r2;
+        }
+    }
+
+    std::cout << "\nPASSED\n";
+    return 0;
+}